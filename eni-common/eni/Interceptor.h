@@ -5,24 +5,45 @@
 #ifndef ENI_INTERCEPTOR_H
 #define ENI_INTERCEPTOR_H
 
+#include <eni/InterceptorProfiler.h>
 #include <eni/build_config.h>
 
 #include <algorithm>
 #include <future>
 #include <list>
 #include <memory>
+#include <tuple>
+#include <type_traits>
 
 namespace eni {
 
+/**
+ * Tag type selecting the shared argument passing mode of InterceptorRegistry::invoke().
+ *
+ * In this mode the invocation arguments are moved (or copied, if passed as lvalues) exactly once into immutable storage
+ * that is shared by all interceptors. Each interceptor receives const references into that storage, which is kept alive
+ * until the last interceptor has finished.
+ */
+struct shared_args_t {
+    explicit shared_args_t() = default;
+};
+
+/**
+ * Selects the shared argument passing mode of InterceptorRegistry::invoke().
+ */
+inline constexpr shared_args_t shared_args{};
+
 /**
  * A registry for intercepting a single point-in-code. All registered Interceptors will be invoked in order of priority when the registries invoke() method has been called.
  *
  * @tparam InterceptorT The interceptor type
+ * @tparam ProfilerT The profiler measuring each interceptor call, see InterceptorProfiler. Profiling is disabled by default.
  */
-template<typename InterceptorT>
+template<typename InterceptorT, typename ProfilerT = NullInterceptorProfiler>
 class InterceptorRegistry {
 public:
     using interceptor_type = InterceptorT;
+    using profiler_type = ProfilerT;
 
     InterceptorRegistry &operator=(const InterceptorRegistry &other) = delete;
 
@@ -59,8 +80,17 @@ public:
      * @param interceptor The interceptor to remove.
      */
     void unregisterInterceptor(const std::shared_ptr<interceptor_type> &interceptor) {
-        auto it = std::find_if(_interceptors.begin(), _interceptors.end(), [&interceptor](const auto &i) { return i.second == interceptor; });
+        const auto isInterceptor = [&interceptor](const auto &i) { return i.second == interceptor; };
+        auto it = std::find_if(_interceptors.begin(), _interceptors.end(), isInterceptor);
+        if (it == _interceptors.end()) {
+            return;
+        }
         _interceptors.erase(it);
+
+        // Statistics are keyed by address, do not let a later interceptor at the same address inherit them.
+        if (std::none_of(_interceptors.begin(), _interceptors.end(), isInterceptor)) {
+            _profiler.erase(interceptor.get());
+        }
     }
 
 public:
@@ -71,6 +101,7 @@ public:
     template<typename... ArgsT, typename... FunArgsT>
     void invoke(void (interceptor_type::*FunT)(FunArgsT...), ArgsT &&...args) const {
         for (const auto &i : _interceptors) {
+            [[maybe_unused]] auto scope = _profiler.measure(i.second.get());
             if constexpr (sizeof...(ArgsT) > 0) {
                 ((*i.second).*FunT)(std::forward<ArgsT>(args)...);
             } else {
@@ -86,6 +117,7 @@ public:
     template<typename... ArgsT, typename... FunArgsT>
     void invoke(void (interceptor_type::*FunT)(FunArgsT...) const, ArgsT &&...args) {
         for (const auto &i : _interceptors) {
+            [[maybe_unused]] auto scope = _profiler.measure(i.second.get());
             if constexpr (sizeof...(ArgsT) > 0) {
                 ((*i.second).*FunT)(std::forward<ArgsT>(args)...);
             } else {
@@ -124,12 +156,21 @@ public:
     std::future<void> invoke(std::launch launch_type, std::future<void> (interceptor_type::*FunT)(FunArgsT...), ArgsT &&...args) {
         return std::async(launch_type, [this, FunT, args...]() mutable {
             for (const auto &i : _interceptors) {
+                [[maybe_unused]] auto scope = _profiler.measure(i.second.get());
+                std::future<void> result;
+
                 if constexpr (sizeof...(ArgsT) > 0) {
                     // We can't perfect forward the arguments here because they might illegally transfer their ownership.
                     // The function invoked needs to use either referenced or copy-by-value parameters.
-                    ((*i.second).*FunT)(args...);
+                    result = ((*i.second).*FunT)(args...);
                 } else {
-                    ((*i.second).*FunT)();
+                    result = ((*i.second).*FunT)();
+                }
+
+                // When profiling, wait for each interceptor, so that it is measured until it has completed rather than
+                // only launched. Otherwise the result is discarded as before.
+                if constexpr (!std::is_same_v<profiler_type, NullInterceptorProfiler>) {
+                    result.get();
                 }
             }
         });
@@ -145,6 +186,7 @@ public:
     std::future<void> invoke(std::launch launch_type, std::future<void> (interceptor_type::*FunT)(FunArgsT...) const, ArgsT &&...args) {
         return std::async(launch_type, [this, FunT, args...]() mutable {
             for (const auto &i : _interceptors) {
+                [[maybe_unused]] auto scope = _profiler.measure(i.second.get());
                 std::future<void> result;
 
                 if constexpr (sizeof...(ArgsT) > 0) {
@@ -158,6 +200,48 @@ public:
         });
     }
 
+    /**
+     * Asynchronously invokes the registered Interceptors in order of priority, sharing a single copy of the arguments.
+     * @param FunT The method to invoke, must accept its parameters by const reference or by value.
+     * @param args The invocation arguments, moved once into storage shared by all interceptors.
+     */
+    template<typename... ArgsT, typename... FunArgsT>
+    std::future<void> invoke(shared_args_t /*unused*/, std::future<void> (interceptor_type::*FunT)(FunArgsT...), ArgsT &&...args) {
+        return _invokeShared(std::launch::async, FunT, std::forward<ArgsT>(args)...);
+    }
+
+    /**
+     * Asynchronously invokes the registered Interceptors in order of priority, sharing a single copy of the arguments.
+     * @param FunT The method to invoke, must accept its parameters by const reference or by value.
+     * @param args The invocation arguments, moved once into storage shared by all interceptors.
+     */
+    template<typename... ArgsT, typename... FunArgsT>
+    std::future<void> invoke(shared_args_t /*unused*/, std::future<void> (interceptor_type::*FunT)(FunArgsT...) const, ArgsT &&...args) {
+        return _invokeShared(std::launch::async, FunT, std::forward<ArgsT>(args)...);
+    }
+
+    /**
+     * Asynchronously invokes the registered Interceptors in order of priority, sharing a single copy of the arguments.
+     * @param launch_type The async launch type
+     * @param FunT The method to invoke, must accept its parameters by const reference or by value.
+     * @param args The invocation arguments, moved once into storage shared by all interceptors.
+     */
+    template<typename... ArgsT, typename... FunArgsT>
+    std::future<void> invoke(std::launch launch_type, shared_args_t /*unused*/, std::future<void> (interceptor_type::*FunT)(FunArgsT...), ArgsT &&...args) {
+        return _invokeShared(launch_type, FunT, std::forward<ArgsT>(args)...);
+    }
+
+    /**
+     * Asynchronously invokes the registered Interceptors in order of priority, sharing a single copy of the arguments.
+     * @param launch_type The async launch type
+     * @param FunT The method to invoke, must accept its parameters by const reference or by value.
+     * @param args The invocation arguments, moved once into storage shared by all interceptors.
+     */
+    template<typename... ArgsT, typename... FunArgsT>
+    std::future<void> invoke(std::launch launch_type, shared_args_t /*unused*/, std::future<void> (interceptor_type::*FunT)(FunArgsT...) const, ArgsT &&...args) {
+        return _invokeShared(launch_type, FunT, std::forward<ArgsT>(args)...);
+    }
+
 public:
     /**
      * @return An iterator view of registered interceptors.
@@ -166,8 +250,31 @@ public:
         return std::make_pair(_interceptors.begin(), _interceptors.end());
     }
 
+    /**
+     * @return The profiler measuring the interceptor calls of this registry.
+     */
+    [[nodiscard]] inline profiler_type &getProfiler() const {
+        return _profiler;
+    }
+
+private:
+    template<typename MethodT, typename... ArgsT>
+    std::future<void> _invokeShared(std::launch launch_type, MethodT FunT, ArgsT &&...args) {
+        // The arguments are stored exactly once. Interceptors only ever see const references into the storage, so no
+        // interceptor is able to move the payload away from the ones invoked after it.
+        auto sharedArgs = std::make_shared<const std::tuple<std::decay_t<ArgsT>...>>(std::forward<ArgsT>(args)...);
+
+        return std::async(launch_type, [this, FunT, sharedArgs = std::move(sharedArgs)]() {
+            for (const auto &i : _interceptors) {
+                [[maybe_unused]] auto scope = _profiler.measure(i.second.get());
+                std::apply([&](const auto &...sharedArg) { ((*i.second).*FunT)(sharedArg...).get(); }, *sharedArgs);
+            }
+        });
+    }
+
 private:
     std::list<std::pair<int32, std::shared_ptr<interceptor_type>>> _interceptors;
+    [[no_unique_address]] mutable profiler_type _profiler;
 };
 
 }// namespace eni
@@ -0,0 +1,100 @@
+//
+// Created by void on 10/18/26.
+//
+
+#include <eni/InterceptorProfiler.h>
+#include <eni/logging.h>
+
+#include <algorithm>
+#include <bit>
+
+namespace eni {
+
+namespace detail {
+inline std::size_t getLatencyBucket(std::chrono::nanoseconds duration) {
+    const auto ns = static_cast<uint64>(std::max<std::chrono::nanoseconds::rep>(duration.count(), 1));
+    return std::min<std::size_t>(std::bit_width(ns) - 1, InterceptorStatistics::BucketCount - 1);
+}
+}// namespace detail
+
+std::chrono::nanoseconds InterceptorStatistics::averageTime() const {
+    if (calls == 0) {
+        return {};
+    }
+    return totalTime / calls;
+}
+
+std::chrono::nanoseconds InterceptorStatistics::percentile(double p) const {
+    const auto threshold = static_cast<uint64>(std::clamp(p, 0.0, 1.0) * static_cast<double>(calls));
+    uint64 seen = 0;
+
+    for (std::size_t i = 0; i < BucketCount; ++i) {
+        seen += histogram[i];
+        if (seen > 0 && seen >= threshold) {
+            return std::min(std::chrono::nanoseconds((uint64{1} << (i + 1)) - 1), maxTime);
+        }
+    }
+
+    return maxTime;
+}
+
+InterceptorProfiler::InterceptorProfiler(std::string loggerName, std::chrono::nanoseconds budget)
+    : _logger(get_logger(loggerName)), _budget(budget.count()) {}
+
+void InterceptorProfiler::record(const void *interceptor, std::chrono::nanoseconds duration) {
+    const auto budget = getBudget();
+    const bool exceeded = duration > budget;
+    bool report = false;
+
+    {
+        auto lk = std::lock_guard(_mutex);
+        auto &statistics = _statistics[interceptor];
+        statistics.calls++;
+        statistics.totalTime += duration;
+        statistics.maxTime = std::max(statistics.maxTime, duration);
+        statistics.histogram[detail::getLatencyBucket(duration)]++;
+
+        if (exceeded) {
+            // Only the first violation is logged, a slow interceptor on a hot path would flood the log otherwise.
+            report = statistics.budgetExceeded++ == 0;
+        }
+    }
+
+    if (report) {
+        _logger.warn("Interceptor {} took {}ns, exceeding its budget of {}ns, further violations are only counted",
+                     interceptor, duration.count(), budget.count());
+    }
+}
+
+void InterceptorProfiler::setBudget(std::chrono::nanoseconds budget) {
+    _budget = budget.count();
+}
+
+std::chrono::nanoseconds InterceptorProfiler::getBudget() const {
+    return std::chrono::nanoseconds(_budget.load());
+}
+
+std::optional<InterceptorStatistics> InterceptorProfiler::getStatistics(const void *interceptor) const {
+    auto lk = std::lock_guard(_mutex);
+    if (auto it = _statistics.find(interceptor); it != _statistics.end()) {
+        return it->second;
+    }
+    return std::nullopt;
+}
+
+std::vector<std::pair<const void *, InterceptorStatistics>> InterceptorProfiler::getStatistics() const {
+    auto lk = std::lock_guard(_mutex);
+    return {_statistics.begin(), _statistics.end()};
+}
+
+void InterceptorProfiler::erase(const void *interceptor) {
+    auto lk = std::lock_guard(_mutex);
+    _statistics.erase(interceptor);
+}
+
+void InterceptorProfiler::reset() {
+    auto lk = std::lock_guard(_mutex);
+    _statistics.clear();
+}
+
+}// namespace eni
@@ -0,0 +1,162 @@
+//
+// Created by void on 10/18/26.
+//
+
+#ifndef ENI_INTERCEPTOR_PROFILER_H
+#define ENI_INTERCEPTOR_PROFILER_H
+
+#include <eni/build_config.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace spdlog {
+class logger;
+}// namespace spdlog
+
+namespace eni {
+
+/**
+ * The default profiler of an InterceptorRegistry. It does not record anything and compiles out completely.
+ */
+struct NullInterceptorProfiler {
+    struct Scope {};
+
+    static constexpr Scope measure(const void * /*interceptor*/) { return {}; }
+
+    static constexpr void erase(const void * /*interceptor*/) {}
+};
+
+/**
+ * Timing statistics recorded for a single interceptor.
+ */
+struct InterceptorStatistics {
+    /// The number of latency histogram buckets, bucket i counts calls taking [2^i, 2^(i+1)) nanoseconds.
+    static constexpr std::size_t BucketCount = 40;
+
+    uint64 calls = 0;
+    uint64 budgetExceeded = 0;
+    std::chrono::nanoseconds totalTime{};
+    std::chrono::nanoseconds maxTime{};
+    std::array<uint64, BucketCount> histogram{};
+
+    /**
+     * @return The average time spent per call.
+     */
+    [[nodiscard]] std::chrono::nanoseconds averageTime() const;
+
+    /**
+     * Estimates a latency percentile from the histogram.
+     * @param p The percentile in the range [0, 1].
+     * @return The upper bound of the histogram bucket containing the percentile.
+     */
+    [[nodiscard]] std::chrono::nanoseconds percentile(double p) const;
+};
+
+/**
+ * A profiler for InterceptorRegistry that records call counts and latency distributions per interceptor and reports
+ * interceptors exceeding a time budget to the eni logging facility. Only the first budget violation of each interceptor
+ * is logged, further ones are counted in InterceptorStatistics::budgetExceeded. Asynchronous interceptor methods are
+ * measured until the future they return has completed.
+ *
+ * Usage: InterceptorRegistry<MyInterceptor, InterceptorProfiler>
+ */
+class InterceptorProfiler {
+public:
+    /**
+     * Measures a single interceptor call until it goes out of scope.
+     */
+    class Scope {
+    public:
+        Scope(InterceptorProfiler &profiler, const void *interceptor)
+            : _profiler(profiler), _interceptor(interceptor), _start(std::chrono::steady_clock::now()) {}
+
+        Scope(const Scope &) = delete;
+        Scope &operator=(const Scope &) = delete;
+
+        ~Scope() {
+            _profiler.record(_interceptor, std::chrono::steady_clock::now() - _start);
+        }
+
+    private:
+        InterceptorProfiler &_profiler;
+        const void *_interceptor;
+        std::chrono::steady_clock::time_point _start;
+    };
+
+public:
+    /**
+     * @param loggerName The name of the logger to report the first budget violation of each interceptor to.
+     * @param budget The time a single interceptor call may take before it is reported.
+     */
+    explicit InterceptorProfiler(std::string loggerName = "Interceptor",
+                                 std::chrono::nanoseconds budget = std::chrono::nanoseconds::max());
+
+    /**
+     * Starts measuring a call of the given interceptor.
+     * @param interceptor The interceptor being invoked.
+     * @return The scope that records the call when destroyed.
+     */
+    [[nodiscard]] Scope measure(const void *interceptor) {
+        return {*this, interceptor};
+    }
+
+    /**
+     * Records a call of an interceptor.
+     * @param interceptor The interceptor that has been invoked.
+     * @param duration The time the call took.
+     */
+    void record(const void *interceptor, std::chrono::nanoseconds duration);
+
+    /**
+     * Sets the time a single interceptor call may take before it is reported.
+     * @param budget The budget.
+     */
+    void setBudget(std::chrono::nanoseconds budget);
+
+    /**
+     * @return The time a single interceptor call may take before it is reported.
+     */
+    [[nodiscard]] std::chrono::nanoseconds getBudget() const;
+
+    /**
+     * @param interceptor The interceptor.
+     * @return The statistics of the given interceptor or an empty optional if it has never been invoked.
+     */
+    [[nodiscard]] std::optional<InterceptorStatistics> getStatistics(const void *interceptor) const;
+
+    /**
+     * @return The statistics of all interceptors invoked so far.
+     */
+    [[nodiscard]] std::vector<std::pair<const void *, InterceptorStatistics>> getStatistics() const;
+
+    /**
+     * Drops the statistics of an interceptor, so that they are not inherited by another one at the same address.
+     * InterceptorRegistry does so when the interceptor is unregistered.
+     * @param interceptor The interceptor.
+     */
+    void erase(const void *interceptor);
+
+    /**
+     * Clears all recorded statistics.
+     */
+    void reset();
+
+private:
+    spdlog::logger &_logger;
+    std::atomic<std::chrono::nanoseconds::rep> _budget;
+
+    mutable std::mutex _mutex;
+    std::unordered_map<const void *, InterceptorStatistics> _statistics;
+};
+
+}// namespace eni
+
+#endif//ENI_INTERCEPTOR_PROFILER_H
@@ -5,41 +5,132 @@
 #ifndef ENI_MANAGED_OBJECT_H
 #define ENI_MANAGED_OBJECT_H
 
+#include <eni/memory/ObjectAccounting.h>
+#include <eni/memory/ReleaseQueue.h>
+
+#include <atomic>
+#include <cassert>
 #include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
 
 namespace eni {
 
 template<typename T>
+class SlotMap;
+
+/**
+ * Base class for objects that need to be released explicitly before they are destroyed.
+ *
+ * Enable the ENI_MANAGED_OBJECT_ACCOUNTING CMake option to record the lifecycle of all objects created by create() in
+ * ObjectAccounting. The definition changes this class, so it must be the same in every translation unit; the option
+ * defines it for the library and everything linking it.
+ *
+ * @tparam T The managed type.
+ * @tparam AllocatorT The allocator used by create(), e.g. PoolAllocator<T>. Defaults to plain new/delete.
+ */
+template<typename T, typename AllocatorT = std::allocator<T>>
 class ManagedObject {
+    template<typename>
+    friend class SlotMap;
+
 protected:
     ~ManagedObject() = default;
 
 private:
+    using allocator_traits = std::allocator_traits<AllocatorT>;
+    static constexpr bool UsesDefaultAllocator = std::is_same_v<AllocatorT, std::allocator<T>>;
+
     struct Deleter {
         void operator()(T *ptr) {
             auto managedObjectReleasedBeforeDestruction = ptr->_released;
+#ifdef ENI_MANAGED_OBJECT_ACCOUNTING
+            if (!managedObjectReleasedBeforeDestruction) {
+                ObjectAccounting::recordUnreleasedDestruction<T>(ptr);
+            }
+#endif
             assert(managedObjectReleasedBeforeDestruction);
-            std::default_delete<T>().operator()(ptr);
+
+            if (auto *queue = _releaseQueue.load(std::memory_order_acquire)) {
+                queue->enqueue(ptr, &ManagedObject::_destroy);
+            } else {
+                _destroy(ptr);
+            }
         }
     };
 
+    static void _destroy(void *memory) {
+        auto *ptr = static_cast<T *>(memory);
+#ifdef ENI_MANAGED_OBJECT_ACCOUNTING
+        ObjectAccounting::recordDestroyed<T>();
+#endif
+
+        if constexpr (UsesDefaultAllocator) {
+            std::default_delete<T>().operator()(ptr);
+        } else {
+            AllocatorT allocator;
+            ptr->~T();
+            allocator_traits::deallocate(allocator, ptr, 1);
+        }
+    }
+
 public:
     using unique_ptr = std::unique_ptr<T, Deleter>;
+    using allocator_type = AllocatorT;
 
 public:
     template<typename... Args>
     static unique_ptr create(Args &&...args) {
-        auto ptr = new T(std::forward<Args>(args)...);// NOLINT(cppcoreguidelines-owning-memory)
-        static_cast<ManagedObject<T> *>(ptr)->onInit();
+        T *ptr = nullptr;
+
+        if constexpr (UsesDefaultAllocator) {
+            ptr = new T(std::forward<Args>(args)...);// NOLINT(cppcoreguidelines-owning-memory)
+        } else {
+            AllocatorT allocator;
+            auto *memory = allocator_traits::allocate(allocator, 1);
+            try {
+                ptr = ::new (static_cast<void *>(memory)) T(std::forward<Args>(args)...);
+            } catch (...) {
+                allocator_traits::deallocate(allocator, memory, 1);
+                throw;
+            }
+        }
+
+        static_cast<ManagedObject *>(ptr)->onInit();
+#ifdef ENI_MANAGED_OBJECT_ACCOUNTING
+        ObjectAccounting::recordCreated<T>();
+#endif
         return unique_ptr(ptr);
     }
 
+    /**
+     * Enables deferred destruction for all objects of this type. Destroying a released object then only queues its
+     * destruction, which is run later in bulk by the given queue.
+     *
+     * @param queue The queue to defer destructions to, or nullptr to destroy objects immediately again. The queue must
+     * outlive all objects destroyed while it is set.
+     */
+    static void setReleaseQueue(ReleaseQueue *queue) {
+        _releaseQueue.store(queue, std::memory_order_release);
+    }
+
+    /**
+     * @return The queue destructions of this type are deferred to, or nullptr if objects are destroyed immediately.
+     */
+    [[nodiscard]] static ReleaseQueue *getReleaseQueue() {
+        return _releaseQueue.load(std::memory_order_acquire);
+    }
+
 public:
     void release() {
         if (_released) {
             throw std::logic_error("Object has already been released");
         }
         _released = true;
+#ifdef ENI_MANAGED_OBJECT_ACCOUNTING
+        ObjectAccounting::recordReleased<T>();
+#endif
         onRelease();
     }
 
@@ -48,9 +139,58 @@ protected:
     virtual void onRelease() {}
 
 private:
+    /**
+     * Called by SlotMap after it constructed the object in place, in lieu of create().
+     */
+    void _initInSlotMap() {
+        onInit();
+#ifdef ENI_MANAGED_OBJECT_ACCOUNTING
+        ObjectAccounting::recordCreated<T>();
+#endif
+    }
+
+    /**
+     * Called by SlotMap before it destroys the object, in lieu of the Deleter. The object may have been released
+     * already, it is not released twice.
+     */
+    void _eraseFromSlotMap() {
+        if (!_released) {
+            release();
+        }
+#ifdef ENI_MANAGED_OBJECT_ACCOUNTING
+        ObjectAccounting::recordDestroyed<T>();
+#endif
+    }
+
+private:
+    static inline std::atomic<ReleaseQueue *> _releaseQueue = nullptr;
+
     bool _released = false;
 };
 
+namespace detail {
+template<typename T, typename AllocatorT>
+ManagedObject<T, AllocatorT> &as_managed_object(ManagedObject<T, AllocatorT> &object) {
+    return object;
+}
+}// namespace detail
+
+/**
+ * @brief Concept for identifying types derived from ManagedObject<T>.
+ *
+ * @tparam T The type to check.
+ */
+template<typename T>
+concept managed_object_type = requires(T &t) { detail::as_managed_object<T>(t); };
+
+/**
+ * @brief Concept for identifying types derived from any ManagedObject, including types derived from a managed type.
+ *
+ * @tparam T The type to check.
+ */
+template<typename T>
+concept derived_managed_object_type = requires(T &t) { detail::as_managed_object(t); };
+
 }// namespace eni
 
 #endif//ENI_MANAGED_OBJECT_H
@@ -0,0 +1,269 @@
+//
+// Created by void on 10/18/26.
+//
+
+#ifndef ENI_SLOT_MAP_H
+#define ENI_SLOT_MAP_H
+
+#include <eni/ManagedObject.h>
+#include <eni/build_config.h>
+
+#include <cassert>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace eni {
+
+/**
+ * A 64-bit generational handle to an object owned by a SlotMap. Handles stay valid until their object is erased and
+ * are never confused with objects created later in the same slot.
+ */
+class SlotHandle {
+public:
+    constexpr SlotHandle() = default;
+
+    constexpr SlotHandle(uint32 index, uint32 generation)
+        : _value((static_cast<uint64>(generation) << 32U) | index) {}
+
+    /**
+     * @return The index of the slot referenced by this handle.
+     */
+    [[nodiscard]] constexpr uint32 getIndex() const {
+        return static_cast<uint32>(_value);
+    }
+
+    /**
+     * @return The generation of the slot at the time the handle was created.
+     */
+    [[nodiscard]] constexpr uint32 getGeneration() const {
+        return static_cast<uint32>(_value >> 32U);
+    }
+
+    /**
+     * @return The raw handle value, e.g. for serialization.
+     */
+    [[nodiscard]] constexpr uint64 getValue() const {
+        return _value;
+    }
+
+    /**
+     * @return Whether this handle has been issued by a SlotMap. It may refer to an erased object nonetheless.
+     */
+    [[nodiscard]] constexpr bool isNull() const {
+        return getGeneration() == 0;
+    }
+
+    constexpr bool operator==(const SlotHandle &other) const = default;
+
+private:
+    uint64 _value = 0;
+};
+
+/**
+ * A container that owns its objects contiguously and hands out generational handles to them.
+ *
+ * Lookups by handle are O(1) and validated, so handles to erased objects are detected instead of dangling. Objects are
+ * kept densely packed for fast iteration; erasing moves the last object into the freed position, so pointers and
+ * iteration order are not stable across insertions and removals but handles are.
+ *
+ * If T is derived from a ManagedObject, its onInit() is invoked on insertion and release() is invoked before it is
+ * destroyed, unless it has been released already. As the objects are not made by create(), their creation and
+ * destruction are recorded in ObjectAccounting by the map, under the type of their ManagedObject base.
+ *
+ * @tparam T The object type, must be move-constructible and move-assignable.
+ */
+template<typename T>
+class SlotMap {
+public:
+    using value_type = T;
+    using handle_type = SlotHandle;
+    using iterator = typename std::vector<T>::iterator;
+    using const_iterator = typename std::vector<T>::const_iterator;
+
+public:
+    SlotMap() = default;
+    SlotMap(const SlotMap &) = delete;
+    SlotMap &operator=(const SlotMap &) = delete;
+
+    SlotMap(SlotMap &&other) noexcept
+        : _objects(std::move(other._objects)), _objectSlots(std::move(other._objectSlots)),
+          _slots(std::move(other._slots)), _freeHead(std::exchange(other._freeHead, NoSlot)) {}
+
+    SlotMap &operator=(SlotMap &&other) noexcept {
+        if (this != &other) {
+            clear();
+            _objects = std::move(other._objects);
+            _objectSlots = std::move(other._objectSlots);
+            _slots = std::move(other._slots);
+            _freeHead = std::exchange(other._freeHead, NoSlot);
+        }
+        return *this;
+    }
+
+    ~SlotMap() {
+        clear();
+    }
+
+public:
+    /**
+     * Constructs a new object in place.
+     * @param args The constructor arguments.
+     * @return The handle of the new object.
+     */
+    template<typename... ArgsT>
+    handle_type emplace(ArgsT &&...args) {
+        uint32 index = 0;
+        if (_freeHead != NoSlot) {
+            index = _freeHead;
+            _freeHead = _slots[index].target;
+        } else {
+            assert(_slots.size() < NoSlot);
+            index = static_cast<uint32>(_slots.size());
+            _slots.push_back({NoSlot, 1});
+        }
+
+        auto &slot = _slots[index];
+        try {
+            _objects.emplace_back(std::forward<ArgsT>(args)...);
+        } catch (...) {
+            slot.target = _freeHead;
+            _freeHead = index;
+            throw;
+        }
+
+        slot.target = static_cast<uint32>(_objects.size() - 1);
+        _objectSlots.push_back(index);
+
+        if constexpr (derived_managed_object_type<T>) {
+            detail::as_managed_object(_objects.back())._initInSlotMap();
+        }
+
+        return {index, slot.generation};
+    }
+
+    /**
+     * Erases an object, releasing it first if it is a ManagedObject.
+     * @param handle The handle of the object.
+     * @return Whether the handle referred to an object.
+     */
+    bool erase(handle_type handle) {
+        if (!contains(handle)) {
+            return false;
+        }
+
+        auto &slot = _slots[handle.getIndex()];
+        const auto position = slot.target;
+
+        if constexpr (derived_managed_object_type<T>) {
+            detail::as_managed_object(_objects[position])._eraseFromSlotMap();
+        }
+
+        if (position != _objects.size() - 1) {
+            _objects[position] = std::move(_objects.back());
+            _objectSlots[position] = _objectSlots.back();
+            _slots[_objectSlots[position]].target = position;
+        }
+        _objects.pop_back();
+        _objectSlots.pop_back();
+
+        // Generation 0 is reserved for null handles
+        slot.generation = slot.generation == std::numeric_limits<uint32>::max() ? 1 : slot.generation + 1;
+        slot.target = _freeHead;
+        _freeHead = handle.getIndex();
+
+        return true;
+    }
+
+    /**
+     * Erases all objects, releasing them first if they are ManagedObjects. All handles are invalidated.
+     */
+    void clear() {
+        while (!_objects.empty()) {
+            erase(getHandle(_objects.size() - 1));
+        }
+    }
+
+    /**
+     * @param handle The handle of the object.
+     * @return Whether the handle refers to an object of this map.
+     */
+    [[nodiscard]] bool contains(handle_type handle) const {
+        // Erasing an object bumps the generation of its slot, so free slots never match an issued handle.
+        return !handle.isNull() && handle.getIndex() < _slots.size() &&
+               _slots[handle.getIndex()].generation == handle.getGeneration();
+    }
+
+    /**
+     * @param handle The handle of the object.
+     * @return The object or nullptr if the handle does not refer to an object of this map.
+     */
+    [[nodiscard]] T *get(handle_type handle) {
+        return contains(handle) ? &_objects[_slots[handle.getIndex()].target] : nullptr;
+    }
+
+    /**
+     * @param handle The handle of the object.
+     * @return The object or nullptr if the handle does not refer to an object of this map.
+     */
+    [[nodiscard]] const T *get(handle_type handle) const {
+        return contains(handle) ? &_objects[_slots[handle.getIndex()].target] : nullptr;
+    }
+
+    /**
+     * @param position The position of an object in iteration order.
+     * @return The handle of the object.
+     */
+    [[nodiscard]] handle_type getHandle(std::size_t position) const {
+        const auto index = _objectSlots[position];
+        return {index, _slots[index].generation};
+    }
+
+    /**
+     * @param object An object owned by this map.
+     * @return The handle of the object.
+     */
+    [[nodiscard]] handle_type getHandle(const T &object) const {
+        return getHandle(static_cast<std::size_t>(&object - _objects.data()));
+    }
+
+    /**
+     * Reserves storage for the given number of objects.
+     */
+    void reserve(std::size_t capacity) {
+        _objects.reserve(capacity);
+        _objectSlots.reserve(capacity);
+        _slots.reserve(capacity);
+    }
+
+    [[nodiscard]] std::size_t size() const { return _objects.size(); }
+    [[nodiscard]] bool empty() const { return _objects.empty(); }
+
+    [[nodiscard]] iterator begin() { return _objects.begin(); }
+    [[nodiscard]] iterator end() { return _objects.end(); }
+    [[nodiscard]] const_iterator begin() const { return _objects.begin(); }
+    [[nodiscard]] const_iterator end() const { return _objects.end(); }
+
+    /**
+     * @return The contiguous storage of all objects.
+     */
+    [[nodiscard]] T *data() { return _objects.data(); }
+    [[nodiscard]] const T *data() const { return _objects.data(); }
+
+private:
+    static constexpr uint32 NoSlot = std::numeric_limits<uint32>::max();
+
+    struct Slot {
+        uint32 target;    //< The position of the object while occupied, the next free slot otherwise.
+        uint32 generation;//< Incremented each time the object of the slot is erased.
+    };
+
+    std::vector<T> _objects;
+    std::vector<uint32> _objectSlots;
+    std::vector<Slot> _slots;
+    uint32 _freeHead = NoSlot;
+};
+
+}// namespace eni
+
+#endif//ENI_SLOT_MAP_H
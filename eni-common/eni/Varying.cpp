@@ -6,6 +6,14 @@
 
 namespace eni {
 
+bool VaryingConditional::evaluateCondition(const VaryingEnvironment &environment) const {
+    return VaryingCondition::compile(condition)->evaluate(environment);
+}
+
+bool VaryingString::isValid(std::wstring_view value) const {
+    return VaryingPattern::compile(validPattern)->matches(value);
+}
+
 bool VaryingString::operator==(const VaryingString &other) const {
     return other.defaultValue == defaultValue && other.validPattern == validPattern && other.condition == condition;
 }
@@ -5,14 +5,21 @@
 #ifndef ENI_VARYING_H
 #define ENI_VARYING_H
 
+#include <eni/VaryingCondition.h>
+#include <eni/VaryingPattern.h>
+#include <eni/algorithm/range_check.h>
 #include <eni/build_config.h>
 
 #include <complex>
+#include <functional>
 #include <limits>
 #include <memory>
+#include <span>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <variant>
+#include <vector>
 
 namespace eni {
 
@@ -20,6 +27,16 @@ struct VaryingConditional {
     explicit VaryingConditional(std::wstring condition = L"") : condition(std::move(condition)) {}
 
     std::wstring condition;
+
+    /**
+     * Evaluates the condition, compiling it on first use. Hot paths should hold on to VaryingCondition::compile()
+     * instead, which skips the cache lookup.
+     *
+     * @param environment The variables to evaluate against.
+     * @return Whether the condition holds.
+     * @throws ParseException if the condition is malformed.
+     */
+    [[nodiscard]] bool evaluateCondition(const VaryingEnvironment &environment) const;
 };
 
 struct VaryingString : VaryingConditional {
@@ -29,9 +46,47 @@ struct VaryingString : VaryingConditional {
     std::wstring defaultValue;
     std::wstring validPattern;
 
+    /**
+     * Validates a value against validPattern, compiling it on first use. Hot paths should hold on to
+     * VaryingPattern::compile() instead, which skips the cache lookup.
+     *
+     * @param value The value to validate.
+     * @return Whether the whole value matches validPattern.
+     * @throws ParseException if the pattern is malformed.
+     */
+    [[nodiscard]] bool isValid(std::wstring_view value) const;
+
     [[nodiscard]] bool operator==(const VaryingString &other) const;
 };
 
+namespace detail {
+/**
+ * Compares numeric Varying members exactly, except that all NaNs are equal, so that equality stays reflexive.
+ */
+template<typename T>
+constexpr bool varying_value_equal(T a, T b) {
+    if constexpr (std::is_floating_point_v<T>) {
+        if (a != a) {
+            return b != b;
+        }
+    }
+    return a == b;
+}
+
+/**
+ * Hashes numeric Varying members consistently with varying_value_equal().
+ */
+template<typename T>
+std::size_t varying_value_hash(T value) {
+    if constexpr (std::is_floating_point_v<T>) {
+        if (value != value) {
+            return std::hash<T>{}(std::numeric_limits<T>::quiet_NaN());
+        }
+    }
+    return std::hash<T>{}(value);
+}
+}// namespace detail
+
 template<typename T>
 struct VaryingNumeric : VaryingConditional {
     explicit VaryingNumeric(std::wstring condition = L"", T minValue = 0, T maxValue = 0, T defaultValue = 0)
@@ -43,10 +98,44 @@ struct VaryingNumeric : VaryingConditional {
     T minValue = std::numeric_limits<T>::min();
     T maxValue = std::numeric_limits<T>::max();
 
+    /**
+     * Validates values against [minValue, maxValue]. NaN is always out of range.
+     * @param values The values to validate.
+     * @param violations Receives the violation bitmask: bit i % 64 of violations[i / 64] is set if values[i] is out of
+     * range. Must hold at least (values.size() + 63) / 64 words.
+     * @return The number of values out of range.
+     * @see range_violations
+     */
+    std::size_t validate(std::span<const T> values, std::span<uint64> violations) const {
+        return range_violations(values, minValue, maxValue, violations);
+    }
+
+    /**
+     * Validates values against [minValue, maxValue]. NaN is always out of range.
+     * @param values The values to validate.
+     * @return The violation bitmask: bit i % 64 of word i / 64 is set if values[i] is out of range.
+     */
+    [[nodiscard]] std::vector<uint64> validate(std::span<const T> values) const {
+        std::vector<uint64> violations((values.size() + 63) / 64);
+        range_violations(values, minValue, maxValue, std::span(violations));
+        return violations;
+    }
+
+    /**
+     * Clamps values to [minValue, maxValue] in place, replacing NaN with defaultValue.
+     * @param values The values to clamp.
+     * @see clamp_range
+     */
+    void clamp(std::span<T> values) const {
+        clamp_range(values, minValue, maxValue, defaultValue);
+    }
+
+    /**
+     * Compares all members exactly, so that equality is consistent with std::hash. NaN members equal NaN.
+     */
     [[nodiscard]] bool operator==(const VaryingNumeric &other) const {
-        return std::fabs(other.maxValue - maxValue) < std::numeric_limits<real>::epsilon() &&
-               std::fabs(other.minValue - minValue) < std::numeric_limits<real>::epsilon() &&
-               condition == other.condition;
+        return detail::varying_value_equal(other.defaultValue, defaultValue) && detail::varying_value_equal(other.minValue, minValue) &&
+               detail::varying_value_equal(other.maxValue, maxValue) && other.condition == condition;
     }
 };
 
@@ -72,7 +161,31 @@ bool operator==(const VaryingString &varying, const Varying &other);
 bool operator==(const VaryingLong &varying, const Varying &other);
 bool operator==(const VaryingFloat &varying, const Varying &other);
 
+namespace detail {
+inline std::size_t hash_combine(std::size_t seed, std::size_t value) {
+    return seed ^ (value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2));
+}
+}// namespace detail
 
 }// namespace eni
 
+template<>
+struct std::hash<eni::VaryingString> {
+    std::size_t operator()(const eni::VaryingString &varying) const noexcept {
+        auto seed = std::hash<std::wstring>{}(varying.condition);
+        seed = eni::detail::hash_combine(seed, std::hash<std::wstring>{}(varying.validPattern));
+        return eni::detail::hash_combine(seed, std::hash<std::wstring>{}(varying.defaultValue));
+    }
+};
+
+template<typename T>
+struct std::hash<eni::VaryingNumeric<T>> {
+    std::size_t operator()(const eni::VaryingNumeric<T> &varying) const noexcept {
+        auto seed = std::hash<std::wstring>{}(varying.condition);
+        seed = eni::detail::hash_combine(seed, eni::detail::varying_value_hash(varying.defaultValue));
+        seed = eni::detail::hash_combine(seed, eni::detail::varying_value_hash(varying.minValue));
+        return eni::detail::hash_combine(seed, eni::detail::varying_value_hash(varying.maxValue));
+    }
+};
+
 #endif//ENI_VARYING_H
@@ -0,0 +1,88 @@
+//
+// Created by void on 10/18/26.
+//
+
+#ifndef ENI_VARYING_CACHE_H
+#define ENI_VARYING_CACHE_H
+
+#include <eni/build_config.h>
+
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+namespace eni::detail {
+
+/**
+ * A thread-safe cache of compiled conditions or patterns by their source, which keeps the most recently used ones.
+ * Evicted objects stay valid for as long as they are referenced elsewhere.
+ *
+ * @tparam T The compiled type, constructible from its source.
+ */
+template<typename T>
+class VaryingCompileCache {
+public:
+    explicit VaryingCompileCache(std::size_t capacity) : _capacity(capacity) {}
+
+    VaryingCompileCache(const VaryingCompileCache &) = delete;
+    VaryingCompileCache &operator=(const VaryingCompileCache &) = delete;
+
+    /**
+     * Compiles a source or returns it from the cache.
+     * @param source The source.
+     * @return The compiled object.
+     * @throws ParseException if the source is malformed.
+     */
+    std::shared_ptr<const T> get(std::wstring_view source) {
+        {
+            auto lk = std::lock_guard(_mutex);
+            if (auto it = _entries.find(source); it != _entries.end()) {
+                return _touch(it->second);
+            }
+        }
+
+        // Compile outside of the lock, a concurrent compilation of the same source merely wastes some work.
+        auto compiled = std::make_shared<const T>(source);
+
+        auto lk = std::lock_guard(_mutex);
+        if (auto it = _entries.find(source); it != _entries.end()) {
+            return _touch(it->second);
+        }
+
+        _order.emplace_front(std::wstring(source), std::move(compiled));
+        _entries.emplace(_order.front().first, _order.begin());
+        if (_entries.size() > _capacity) {
+            _entries.erase(_order.back().first);
+            _order.pop_back();
+        }
+        return _order.front().second;
+    }
+
+private:
+    using entry_list = std::list<std::pair<std::wstring, std::shared_ptr<const T>>>;
+
+    struct Hash {
+        using is_transparent = void;
+        std::size_t operator()(std::wstring_view str) const { return std::hash<std::wstring_view>{}(str); }
+    };
+
+    const std::shared_ptr<const T> &_touch(typename entry_list::iterator entry) {
+        _order.splice(_order.begin(), _order, entry);
+        return entry->second;
+    }
+
+private:
+    std::mutex _mutex;
+    std::size_t _capacity;
+    entry_list _order;
+    std::unordered_map<std::wstring_view, typename entry_list::iterator, Hash, std::equal_to<>> _entries;
+};
+
+}// namespace eni::detail
+
+#endif//ENI_VARYING_CACHE_H
@@ -0,0 +1,257 @@
+//
+// Created by void on 10/18/26.
+//
+
+#include <eni/VaryingCatalog.h>
+#include <eni/exception.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <ostream>
+
+namespace eni {
+
+namespace detail {
+static_assert(std::same_as<std::variant_alternative_t<0, Varying>, VaryingString>);
+static_assert(std::same_as<std::variant_alternative_t<1, Varying>, VaryingLong>);
+static_assert(std::same_as<std::variant_alternative_t<2, Varying>, VaryingFloat>);
+
+template<typename T>
+inline uint64 to_catalog_bits(T value) {
+    if constexpr (std::same_as<T, double>) {
+        return std::bit_cast<uint64>(value);
+    } else {
+        return static_cast<uint64>(value);
+    }
+}
+
+template<typename T>
+inline T from_catalog_bits(uint64 bits) {
+    if constexpr (std::same_as<T, double>) {
+        return std::bit_cast<double>(bits);
+    } else {
+        return static_cast<T>(bits);
+    }
+}
+
+inline void writeCatalogBytes(std::ostream &os, const void *data, std::size_t size) {
+    os.write(static_cast<const char *>(data), static_cast<std::streamsize>(size));
+}
+}// namespace detail
+
+VaryingString VaryingStringView::toVarying() const {
+    return VaryingString(std::wstring(condition), std::wstring(validPattern), std::wstring(defaultValue));
+}
+
+Varying to_varying(const VaryingView &view) {
+    return std::visit([](const auto &v) -> Varying { return v.toVarying(); }, view);
+}
+
+std::size_t VaryingCatalogWriter::add(const Varying &varying) {
+    if (_entries.size() >= std::numeric_limits<uint32>::max()) {
+        throw IllegalOperationException("Too many entries for a Varying catalog");
+    }
+
+    varying_catalog::Entry entry{};
+    entry.kind = static_cast<uint32>(varying.index());
+
+    std::visit([this, &entry]<typename T>(const T &v) {
+        entry.condition = _addString(v.condition);
+
+        if constexpr (std::same_as<T, VaryingString>) {
+            entry.validPattern = _addString(v.validPattern);
+            entry.defaultString = _addString(v.defaultValue);
+        } else {
+            entry.defaultValue = detail::to_catalog_bits(v.defaultValue);
+            entry.minValue = detail::to_catalog_bits(v.minValue);
+            entry.maxValue = detail::to_catalog_bits(v.maxValue);
+        }
+    },
+               varying);
+
+    _entries.push_back(entry);
+    return _entries.size() - 1;
+}
+
+varying_catalog::StringRef VaryingCatalogWriter::_addString(std::wstring_view str) {
+    if (str.empty()) {
+        return {};
+    }
+
+    const auto [it, inserted] = _stringRefs.try_emplace(std::wstring(str));
+    if (inserted) {
+        // Offsets and lengths are stored as 32-bit values.
+        if (_strings.size() + str.size() > std::numeric_limits<uint32>::max()) {
+            _stringRefs.erase(it);
+            throw IllegalOperationException("Too much string data for a Varying catalog");
+        }
+        it->second = {static_cast<uint32>(_strings.size()), static_cast<uint32>(str.size())};
+        _strings += str;
+    }
+    return it->second;
+}
+
+void VaryingCatalogWriter::write(std::ostream &os) const {
+    using namespace varying_catalog;
+
+    Header header{};
+    header.magic = Magic;
+    header.version = Version;
+    header.wcharSize = sizeof(wchar_t);
+    header.entryCount = static_cast<uint32>(_entries.size());
+    header.entrySize = sizeof(Entry);
+    header.entriesOffset = sizeof(Header);
+    header.stringsOffset = header.entriesOffset + _entries.size() * sizeof(Entry);
+    header.stringsLength = _strings.size();
+
+    detail::writeCatalogBytes(os, &header, sizeof(header));
+    detail::writeCatalogBytes(os, _entries.data(), _entries.size() * sizeof(Entry));
+    detail::writeCatalogBytes(os, _strings.data(), _strings.size() * sizeof(wchar_t));
+
+    if (!os) {
+        throw IOException("Failed to write Varying catalog");
+    }
+}
+
+void VaryingCatalogWriter::write(const std::filesystem::path &path) const {
+    std::ofstream os(path, std::ios::binary | std::ios::trunc);
+    if (!os) {
+        throw IOException("Failed to open " + path.string());
+    }
+    write(os);
+}
+
+VaryingCatalog::VaryingCatalog(std::span<const std::byte> data) {
+    _load(data);
+}
+
+VaryingCatalog::VaryingCatalog(VaryingCatalog &&other) noexcept
+    : _mapping(std::exchange(other._mapping, nullptr)), _mappingSize(std::exchange(other._mappingSize, 0)),
+      _entries(std::exchange(other._entries, {})), _strings(std::exchange(other._strings, {})) {}
+
+VaryingCatalog &VaryingCatalog::operator=(VaryingCatalog &&other) noexcept {
+    if (this != &other) {
+        if (_mapping) {
+            munmap(_mapping, _mappingSize);
+        }
+        _mapping = std::exchange(other._mapping, nullptr);
+        _mappingSize = std::exchange(other._mappingSize, 0);
+        _entries = std::exchange(other._entries, {});
+        _strings = std::exchange(other._strings, {});
+    }
+    return *this;
+}
+
+VaryingCatalog::~VaryingCatalog() {
+    if (_mapping) {
+        munmap(_mapping, _mappingSize);
+    }
+}
+
+VaryingCatalog VaryingCatalog::open(const std::filesystem::path &path) {
+    const auto fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        throw IOException("Failed to open " + path.string() + ": " + std::strerror(errno));
+    }
+
+    struct stat st {};
+    if (fstat(fd, &st) != 0) {
+        ::close(fd);
+        throw IOException("Failed to stat " + path.string() + ": " + std::strerror(errno));
+    }
+
+    const auto size = static_cast<std::size_t>(st.st_size);
+    if (size < sizeof(varying_catalog::Header)) {
+        ::close(fd);
+        throw ParseException(path.string() + " is not a Varying catalog");
+    }
+
+    auto *mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+        throw IOException("Failed to map " + path.string() + ": " + std::strerror(errno));
+    }
+
+    VaryingCatalog catalog;
+    catalog._mapping = mapping;
+    catalog._mappingSize = size;
+    catalog._load({static_cast<const std::byte *>(mapping), size});
+    return catalog;
+}
+
+void VaryingCatalog::_load(std::span<const std::byte> data) {
+    using namespace varying_catalog;
+
+    if (data.size() < sizeof(Header) || reinterpret_cast<std::uintptr_t>(data.data()) % alignof(Entry) != 0) {
+        throw ParseException("Invalid Varying catalog");
+    }
+
+    const auto &header = *reinterpret_cast<const Header *>(data.data());
+    if (header.magic != Magic) {
+        throw ParseException("Invalid Varying catalog");
+    }
+    if (header.version != Version || header.wcharSize != sizeof(wchar_t) || header.entrySize != sizeof(Entry)) {
+        throw ParseException("Unsupported Varying catalog version " + std::to_string(header.version));
+    }
+
+    // Check every part separately, so that a crafted header cannot make the sums wrap around.
+    const auto fits = [size = uint64{data.size()}](uint64 offset, uint64 count, uint64 elementSize) {
+        return offset <= size && count <= (size - offset) / elementSize;
+    };
+    if (header.entriesOffset % alignof(Entry) != 0 || header.stringsOffset % alignof(wchar_t) != 0 ||
+        !fits(header.entriesOffset, header.entryCount, sizeof(Entry)) ||
+        !fits(header.stringsOffset, header.stringsLength, sizeof(wchar_t)) ||
+        header.stringsOffset < header.entriesOffset + uint64{header.entryCount} * sizeof(Entry)) {
+        throw ParseException("Truncated Varying catalog");
+    }
+
+    _entries = {reinterpret_cast<const Entry *>(data.data() + header.entriesOffset), header.entryCount};
+    _strings = {reinterpret_cast<const wchar_t *>(data.data() + header.stringsOffset), header.stringsLength};
+
+    for (const auto &entry : _entries) {
+        const auto outOfBounds = [this](StringRef ref) { return uint64{ref.offset} + ref.length > _strings.size(); };
+        if (entry.kind >= std::variant_size_v<Varying> || outOfBounds(entry.condition) ||
+            outOfBounds(entry.validPattern) || outOfBounds(entry.defaultString)) {
+            throw ParseException("Corrupt Varying catalog entry");
+        }
+    }
+}
+
+std::wstring_view VaryingCatalog::_getString(varying_catalog::StringRef ref) const {
+    return _strings.substr(ref.offset, ref.length);
+}
+
+VaryingView VaryingCatalog::operator[](std::size_t index) const {
+    const auto &entry = _entries[index];
+    const auto condition = _getString(entry.condition);
+
+    switch (entry.kind) {
+        case 1:
+            return VaryingLongView{condition, detail::from_catalog_bits<int64>(entry.defaultValue),
+                                   detail::from_catalog_bits<int64>(entry.minValue), detail::from_catalog_bits<int64>(entry.maxValue)};
+        case 2:
+            return VaryingFloatView{condition, detail::from_catalog_bits<double>(entry.defaultValue),
+                                    detail::from_catalog_bits<double>(entry.minValue), detail::from_catalog_bits<double>(entry.maxValue)};
+        case 0:
+        default:
+            return VaryingStringView{condition, _getString(entry.validPattern), _getString(entry.defaultString)};
+    }
+}
+
+std::vector<Varying> VaryingCatalog::toVaryings() const {
+    std::vector<Varying> varyings;
+    varyings.reserve(size());
+    for (std::size_t i = 0; i < size(); ++i) {
+        varyings.push_back(to_varying((*this)[i]));
+    }
+    return varyings;
+}
+
+}// namespace eni
@@ -0,0 +1,210 @@
+//
+// Created by void on 10/18/26.
+//
+
+#ifndef ENI_VARYING_CATALOG_H
+#define ENI_VARYING_CATALOG_H
+
+#include <eni/Varying.h>
+#include <eni/build_config.h>
+
+#include <cstddef>
+#include <filesystem>
+#include <iosfwd>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+namespace eni {
+
+/**
+ * A VaryingString read in place from a VaryingCatalog.
+ */
+struct VaryingStringView {
+    std::wstring_view condition;
+    std::wstring_view validPattern;
+    std::wstring_view defaultValue;
+
+    [[nodiscard]] VaryingString toVarying() const;
+};
+
+/**
+ * A VaryingNumeric read in place from a VaryingCatalog.
+ */
+template<typename T>
+struct VaryingNumericView {
+    using value_type = T;
+
+    std::wstring_view condition;
+    T defaultValue;
+    T minValue;
+    T maxValue;
+
+    [[nodiscard]] VaryingNumeric<T> toVarying() const {
+        return VaryingNumeric<T>(std::wstring(condition), minValue, maxValue, defaultValue);
+    }
+};
+
+using VaryingLongView = VaryingNumericView<int64>;
+using VaryingFloatView = VaryingNumericView<double>;
+
+using VaryingView = std::variant<
+        VaryingStringView,
+        VaryingLongView,
+        VaryingFloatView>;
+
+/**
+ * @return The Varying a view refers to.
+ */
+Varying to_varying(const VaryingView &view);
+
+/**
+ * The on-disk layout of a VaryingCatalog.
+ *
+ * A catalog is a header, followed by one fixed-size entry per Varying and the deduplicated string data all entries
+ * refer to. Everything is stored in host byte order, strings as wchar_t without terminator, so a mapped catalog can be
+ * read without any conversion.
+ */
+namespace varying_catalog {
+constexpr uint32 Magic = 0x56494E45;// "ENIV"
+constexpr uint16 Version = 1;
+
+struct Header {
+    uint32 magic;
+    uint16 version;
+    uint8 wcharSize;
+    uint8 reserved;
+    uint32 entryCount;
+    uint32 entrySize;
+    uint64 entriesOffset;
+    uint64 stringsOffset;
+    uint64 stringsLength;//< In characters.
+};
+
+struct StringRef {
+    uint32 offset;//< In characters from the beginning of the string data.
+    uint32 length;
+};
+
+struct Entry {
+    uint32 kind;//< The index of the alternative in Varying.
+    uint32 reserved;
+    StringRef condition;
+    StringRef validPattern;
+    StringRef defaultString;
+    uint64 defaultValue;//< The bits of the int64 or double default value.
+    uint64 minValue;
+    uint64 maxValue;
+};
+
+static_assert(sizeof(Header) == 40);
+static_assert(sizeof(Entry) == 56);
+}// namespace varying_catalog
+
+/**
+ * Writes a collection of Varyings into the binary VaryingCatalog format.
+ */
+class VaryingCatalogWriter {
+public:
+    /**
+     * Appends a Varying to the catalog.
+     * @return The index of the Varying in the catalog.
+     * @throws IllegalOperationException if the catalog would exceed the 32-bit entry count or string offsets.
+     */
+    std::size_t add(const Varying &varying);
+
+    /**
+     * @return The number of Varyings added.
+     */
+    [[nodiscard]] std::size_t size() const { return _entries.size(); }
+
+    /**
+     * Writes the catalog.
+     * @throws IOException if writing fails.
+     */
+    void write(std::ostream &os) const;
+
+    /**
+     * Writes the catalog to a file, replacing it.
+     * @throws IOException if writing fails.
+     */
+    void write(const std::filesystem::path &path) const;
+
+private:
+    varying_catalog::StringRef _addString(std::wstring_view str);
+
+private:
+    std::vector<varying_catalog::Entry> _entries;
+    std::wstring _strings;
+    std::unordered_map<std::wstring, varying_catalog::StringRef> _stringRefs;
+};
+
+/**
+ * A read-only collection of Varyings in the binary format written by VaryingCatalogWriter.
+ *
+ * A catalog is read in place: opening it maps the file and validates the header and the bounds of all entries, but
+ * does not parse or allocate anything per Varying. Entries are returned as views into the mapping, which stay valid as
+ * long as the catalog exists.
+ */
+class VaryingCatalog {
+public:
+    /**
+     * Reads a catalog from memory without copying it.
+     * @param data The catalog, aligned to 8 bytes. Must outlive the catalog.
+     * @throws ParseException if the data is not a valid catalog.
+     */
+    explicit VaryingCatalog(std::span<const std::byte> data);
+
+    VaryingCatalog(VaryingCatalog &&other) noexcept;
+    VaryingCatalog &operator=(VaryingCatalog &&other) noexcept;
+
+    VaryingCatalog(const VaryingCatalog &) = delete;
+    VaryingCatalog &operator=(const VaryingCatalog &) = delete;
+
+    ~VaryingCatalog();
+
+    /**
+     * Maps a catalog file into memory.
+     * @throws IOException if the file cannot be mapped.
+     * @throws ParseException if the file is not a valid catalog.
+     */
+    static VaryingCatalog open(const std::filesystem::path &path);
+
+    /**
+     * @return The number of Varyings in the catalog.
+     */
+    [[nodiscard]] std::size_t size() const { return _entries.size(); }
+
+    [[nodiscard]] bool empty() const { return _entries.empty(); }
+
+    /**
+     * @param index The index of the Varying.
+     * @return A view of the Varying.
+     */
+    [[nodiscard]] VaryingView operator[](std::size_t index) const;
+
+    /**
+     * @return Copies of all Varyings in the catalog.
+     */
+    [[nodiscard]] std::vector<Varying> toVaryings() const;
+
+private:
+    VaryingCatalog() = default;
+
+    void _load(std::span<const std::byte> data);
+    [[nodiscard]] std::wstring_view _getString(varying_catalog::StringRef ref) const;
+
+private:
+    void *_mapping = nullptr;
+    std::size_t _mappingSize = 0;
+
+    std::span<const varying_catalog::Entry> _entries;
+    std::wstring_view _strings;
+};
+
+}// namespace eni
+
+#endif//ENI_VARYING_CATALOG_H
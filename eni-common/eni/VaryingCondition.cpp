@@ -0,0 +1,612 @@
+//
+// Created by void on 10/18/26.
+//
+
+#include <eni/VaryingCache.h>
+#include <eni/VaryingCondition.h>
+#include <eni/exception.h>
+
+#include <array>
+#include <cmath>
+#include <compare>
+#include <cwctype>
+#include <string>
+
+namespace eni {
+
+void VaryingVariables::set(std::wstring name, value_type value) {
+    _variables.insert_or_assign(std::move(name), std::move(value));
+}
+
+void VaryingVariables::unset(std::wstring_view name) {
+    if (auto it = _variables.find(name); it != _variables.end()) {
+        _variables.erase(it);
+    }
+}
+
+VaryingValue VaryingVariables::get(std::wstring_view name) const {
+    auto it = _variables.find(name);
+    if (it == _variables.end()) {
+        return {};
+    }
+
+    return std::visit([](const auto &value) -> VaryingValue {
+        if constexpr (std::is_same_v<std::decay_t<decltype(value)>, std::wstring>) {
+            return std::wstring_view(value);
+        } else {
+            return value;
+        }
+    },
+                      it->second);
+}
+
+/**
+ * A recursive descent compiler translating a condition into bytecode.
+ */
+class VaryingConditionCompiler {
+    using OpCode = VaryingCondition::OpCode;
+
+    enum class TokenType : uint8 {
+        End,
+        Identifier,
+        Integer,
+        Float,
+        String,
+        Operator,
+        LeftParen,
+        RightParen,
+    };
+
+    struct Token {
+        TokenType type = TokenType::End;
+        std::wstring_view text;
+        std::size_t position = 0;
+    };
+
+public:
+    VaryingConditionCompiler(VaryingCondition &condition, std::wstring_view source)
+        : _condition(condition), _source(source) {}
+
+    void compile() {
+        _advance();
+        if (_token.type == TokenType::End) {
+            _emitConstant(true);
+            return;
+        }
+
+        _parseOr();
+        if (_token.type != TokenType::End) {
+            _fail("unexpected token");
+        }
+    }
+
+private:
+    // Parsing
+
+    void _parseOr() {
+        _parseAnd();
+        while (_accept(L"||") || _accept(L"or")) {
+            _emitShortCircuit(OpCode::JumpIfTrue, [this] { _parseAnd(); });
+        }
+    }
+
+    void _parseAnd() {
+        _parseEquality();
+        while (_accept(L"&&") || _accept(L"and")) {
+            _emitShortCircuit(OpCode::JumpIfFalse, [this] { _parseEquality(); });
+        }
+    }
+
+    void _parseEquality() {
+        _parseRelational();
+        while (true) {
+            if (_accept(L"==")) {
+                _parseRelational();
+                _emit(OpCode::Equal);
+            } else if (_accept(L"!=")) {
+                _parseRelational();
+                _emit(OpCode::NotEqual);
+            } else {
+                break;
+            }
+        }
+    }
+
+    void _parseRelational() {
+        _parseAdditive();
+        while (true) {
+            if (_accept(L"<=")) {
+                _parseAdditive();
+                _emit(OpCode::LessEqual);
+            } else if (_accept(L">=")) {
+                _parseAdditive();
+                _emit(OpCode::GreaterEqual);
+            } else if (_accept(L"<")) {
+                _parseAdditive();
+                _emit(OpCode::Less);
+            } else if (_accept(L">")) {
+                _parseAdditive();
+                _emit(OpCode::Greater);
+            } else {
+                break;
+            }
+        }
+    }
+
+    void _parseAdditive() {
+        _parseMultiplicative();
+        while (true) {
+            if (_accept(L"+")) {
+                _parseMultiplicative();
+                _emit(OpCode::Add);
+            } else if (_accept(L"-")) {
+                _parseMultiplicative();
+                _emit(OpCode::Subtract);
+            } else {
+                break;
+            }
+        }
+    }
+
+    void _parseMultiplicative() {
+        _parseUnary();
+        while (true) {
+            if (_accept(L"*")) {
+                _parseUnary();
+                _emit(OpCode::Multiply);
+            } else if (_accept(L"/")) {
+                _parseUnary();
+                _emit(OpCode::Divide);
+            } else if (_accept(L"%")) {
+                _parseUnary();
+                _emit(OpCode::Modulo);
+            } else {
+                break;
+            }
+        }
+    }
+
+    void _parseUnary() {
+        // Unary operators and parentheses recurse, bound them before they exhaust the stack.
+        if (++_nesting > VaryingCondition::MaxNestingDepth) {
+            _fail("expression is nested too deeply");
+        }
+
+        if (_accept(L"!") || _accept(L"not")) {
+            _parseUnary();
+            _emit(OpCode::Not);
+        } else if (_accept(L"-")) {
+            _parseUnary();
+            _emit(OpCode::Negate);
+        } else {
+            _parsePrimary();
+        }
+        _nesting--;
+    }
+
+    void _parsePrimary() {
+        const auto token = _token;
+
+        switch (token.type) {
+            case TokenType::LeftParen:
+                _advance();
+                _parseOr();
+                if (_token.type != TokenType::RightParen) {
+                    _fail("expected ')'");
+                }
+                _advance();
+                return;
+            case TokenType::Integer:
+            case TokenType::Float:
+                try {
+                    // The lexer is lenient, reject tokens like 1.2.3 or 1e that are not consumed entirely.
+                    const std::wstring text(token.text);
+                    std::size_t length = 0;
+                    if (token.type == TokenType::Integer) {
+                        const auto value = static_cast<int64>(std::stoll(text, &length));
+                        if (length != text.size()) {
+                            _fail("invalid number");
+                        }
+                        _emitConstant(value);
+                    } else {
+                        const auto value = std::stod(text, &length);
+                        if (length != text.size()) {
+                            _fail("invalid number");
+                        }
+                        _emitConstant(value);
+                    }
+                } catch (const std::logic_error &) {
+                    _fail("invalid number");
+                }
+                _advance();
+                return;
+            case TokenType::String:
+                _advance();
+                _emitConstant(_unescape(token.text));
+                return;
+            case TokenType::Identifier:
+                _advance();
+                if (token.text == L"true" || token.text == L"false") {
+                    _emitConstant(token.text == L"true");
+                } else if (token.text == L"null") {
+                    _emitConstant(std::monostate());
+                } else {
+                    _emitVariable(token.text);
+                }
+                return;
+            default:
+                _fail("expected a value");
+        }
+    }
+
+    // Code generation
+
+    void _emit(OpCode op, uint32 operand = 0) {
+        switch (op) {
+            case OpCode::PushConstant:
+            case OpCode::PushVariable:
+                _push();
+                break;
+            case OpCode::Not:
+            case OpCode::Negate:
+            case OpCode::ToBool:
+                break;
+            default:
+                // Binary operators and the non-jumping path of conditional jumps consume one operand.
+                _depth--;
+                break;
+        }
+
+        _condition._instructions.push_back({op, operand});
+    }
+
+    template<typename T>
+    void _emitConstant(T value) {
+        auto &constants = _condition._constants;
+        const VaryingCondition::constant_type constant(std::move(value));
+
+        auto index = constants.size();
+        for (std::size_t i = 0; i < constants.size(); ++i) {
+            if (constants[i] == constant) {
+                index = i;
+                break;
+            }
+        }
+        if (index == constants.size()) {
+            constants.push_back(constant);
+        }
+
+        _emit(OpCode::PushConstant, static_cast<uint32>(index));
+    }
+
+    void _emitVariable(std::wstring_view name) {
+        auto &variables = _condition._variables;
+
+        auto index = variables.size();
+        for (std::size_t i = 0; i < variables.size(); ++i) {
+            if (variables[i] == name) {
+                index = i;
+                break;
+            }
+        }
+        if (index == variables.size()) {
+            variables.emplace_back(name);
+        }
+
+        _emit(OpCode::PushVariable, static_cast<uint32>(index));
+    }
+
+    template<typename ParseT>
+    void _emitShortCircuit(OpCode jump, ParseT parseRightHandSide) {
+        auto &instructions = _condition._instructions;
+
+        const auto jumpIndex = instructions.size();
+        _emit(jump);
+        parseRightHandSide();
+        _emit(OpCode::ToBool);
+
+        // Both paths leave exactly one value on the stack
+        instructions[jumpIndex].operand = static_cast<uint32>(instructions.size());
+    }
+
+    void _push() {
+        if (++_depth > VaryingCondition::MaxStackDepth) {
+            _fail("expression is nested too deeply");
+        }
+    }
+
+    // Lexing
+
+    void _advance() {
+        while (_position < _source.size() && std::iswspace(_source[_position])) {
+            _position++;
+        }
+
+        _token = {TokenType::End, {}, _position};
+        if (_position >= _source.size()) {
+            return;
+        }
+
+        const auto start = _position;
+        const auto c = _source[_position];
+
+        if (std::iswalpha(c) || c == L'_') {
+            while (_position < _source.size() && (std::iswalnum(_source[_position]) || _source[_position] == L'_' || _source[_position] == L'.')) {
+                _position++;
+            }
+            _token = {TokenType::Identifier, _source.substr(start, _position - start), start};
+            return;
+        }
+
+        if (std::iswdigit(c) || (c == L'.' && _position + 1 < _source.size() && std::iswdigit(_source[_position + 1]))) {
+            bool isFloat = false;
+            while (_position < _source.size() && (std::iswdigit(_source[_position]) || _source[_position] == L'.')) {
+                isFloat |= _source[_position] == L'.';
+                _position++;
+            }
+            if (_position < _source.size() && (_source[_position] == L'e' || _source[_position] == L'E')) {
+                isFloat = true;
+                _position++;
+                if (_position < _source.size() && (_source[_position] == L'+' || _source[_position] == L'-')) {
+                    _position++;
+                }
+                while (_position < _source.size() && std::iswdigit(_source[_position])) {
+                    _position++;
+                }
+            }
+            _token = {isFloat ? TokenType::Float : TokenType::Integer, _source.substr(start, _position - start), start};
+            return;
+        }
+
+        if (c == L'\'' || c == L'"') {
+            _position++;
+            while (_position < _source.size() && _source[_position] != c) {
+                _position += _source[_position] == L'\\' ? 2 : 1;
+            }
+            if (_position >= _source.size()) {
+                _token.position = start;
+                _fail("unterminated string");
+            }
+            _position++;
+            _token = {TokenType::String, _source.substr(start + 1, _position - start - 2), start};
+            return;
+        }
+
+        if (c == L'(' || c == L')') {
+            _position++;
+            _token = {c == L'(' ? TokenType::LeftParen : TokenType::RightParen, _source.substr(start, 1), start};
+            return;
+        }
+
+        // Longer operators first, so they are not mistaken for their prefixes
+        static constexpr std::array<std::wstring_view, 14> operators = {
+                L"&&", L"||", L"==", L"!=", L"<=", L">=", L"<", L">", L"!", L"+", L"-", L"*", L"/", L"%"};
+        for (const auto op : operators) {
+            if (_source.substr(_position, op.size()) == op) {
+                _position += op.size();
+                _token = {TokenType::Operator, op, start};
+                return;
+            }
+        }
+
+        _fail("unexpected character");
+    }
+
+    bool _accept(std::wstring_view text) {
+        if ((_token.type == TokenType::Operator || _token.type == TokenType::Identifier) && _token.text == text) {
+            _advance();
+            return true;
+        }
+        return false;
+    }
+
+    static std::wstring _unescape(std::wstring_view text) {
+        std::wstring result;
+        result.reserve(text.size());
+        for (std::size_t i = 0; i < text.size(); ++i) {
+            if (text[i] == L'\\' && i + 1 < text.size()) {
+                ++i;
+            }
+            result += text[i];
+        }
+        return result;
+    }
+
+    [[noreturn]] void _fail(const std::string &message) const {
+        throw ParseException("Invalid Varying condition: " + message + " at position " + std::to_string(_token.position));
+    }
+
+private:
+    VaryingCondition &_condition;
+    std::wstring_view _source;
+    std::size_t _position = 0;
+    Token _token;
+    std::size_t _depth = 0;
+    std::size_t _nesting = 0;
+};
+
+namespace detail {
+inline bool isTruthy(const VaryingValue &value) {
+    return std::visit([](const auto &v) -> bool {
+        using T = std::decay_t<decltype(v)>;
+        if constexpr (std::is_same_v<T, std::monostate>) {
+            return false;
+        } else if constexpr (std::is_same_v<T, std::wstring_view>) {
+            return !v.empty();
+        } else {
+            return v != 0;
+        }
+    },
+                      value);
+}
+
+inline bool isNumeric(const VaryingValue &value) {
+    return std::holds_alternative<int64>(value) || std::holds_alternative<double>(value);
+}
+
+inline double toDouble(const VaryingValue &value) {
+    if (const auto *i = std::get_if<int64>(&value)) {
+        return static_cast<double>(*i);
+    }
+    return std::get<double>(value);
+}
+
+/**
+ * @return The ordering of two values, unordered if they are not comparable.
+ */
+inline std::partial_ordering compare(const VaryingValue &a, const VaryingValue &b) {
+    if (std::holds_alternative<int64>(a) && std::holds_alternative<int64>(b)) {
+        return std::get<int64>(a) <=> std::get<int64>(b);
+    }
+    if (isNumeric(a) && isNumeric(b)) {
+        return toDouble(a) <=> toDouble(b);
+    }
+    if (a.index() != b.index()) {
+        return std::partial_ordering::unordered;
+    }
+    if (const auto *s = std::get_if<std::wstring_view>(&a)) {
+        return *s <=> std::get<std::wstring_view>(b);
+    }
+    if (const auto *x = std::get_if<bool>(&a)) {
+        return *x <=> std::get<bool>(b);
+    }
+    return std::partial_ordering::equivalent;// null == null
+}
+
+inline VaryingValue arithmetic(VaryingCondition::OpCode op, const VaryingValue &a, const VaryingValue &b) {
+    using OpCode = VaryingCondition::OpCode;
+
+    if (!isNumeric(a) || !isNumeric(b)) {
+        return {};
+    }
+
+    if (std::holds_alternative<int64>(a) && std::holds_alternative<int64>(b)) {
+        const auto x = std::get<int64>(a);
+        const auto y = std::get<int64>(b);
+        // Results that do not fit into an int64 are computed as doubles instead.
+        int64 result = 0;
+        switch (op) {
+            case OpCode::Add:
+                return __builtin_add_overflow(x, y, &result) ? VaryingValue(static_cast<double>(x) + static_cast<double>(y)) : VaryingValue(result);
+            case OpCode::Subtract:
+                return __builtin_sub_overflow(x, y, &result) ? VaryingValue(static_cast<double>(x) - static_cast<double>(y)) : VaryingValue(result);
+            case OpCode::Multiply:
+                return __builtin_mul_overflow(x, y, &result) ? VaryingValue(static_cast<double>(x) * static_cast<double>(y)) : VaryingValue(result);
+            case OpCode::Divide:
+                if (y == 0) {
+                    return {};
+                }
+                // INT64_MIN / -1 traps.
+                return y == -1 ? arithmetic(OpCode::Subtract, int64{0}, x) : VaryingValue(x / y);
+            case OpCode::Modulo:
+                if (y == 0) {
+                    return {};
+                }
+                return y == -1 ? VaryingValue(int64{0}) : VaryingValue(x % y);
+            default: return {};
+        }
+    }
+
+    const auto x = toDouble(a);
+    const auto y = toDouble(b);
+    switch (op) {
+        case OpCode::Add: return x + y;
+        case OpCode::Subtract: return x - y;
+        case OpCode::Multiply: return x * y;
+        case OpCode::Divide: return x / y;
+        case OpCode::Modulo: return std::fmod(x, y);
+        default: return {};
+    }
+}
+}// namespace detail
+
+VaryingCondition::VaryingCondition(std::wstring_view source) : _source(source) {
+    VaryingConditionCompiler(*this, _source).compile();
+}
+
+std::shared_ptr<const VaryingCondition> VaryingCondition::compile(std::wstring_view source) {
+    static detail::VaryingCompileCache<VaryingCondition> cache(CacheCapacity);
+    return cache.get(source);
+}
+
+bool VaryingCondition::evaluate(const VaryingEnvironment &environment) const {
+    return detail::isTruthy(evaluateValue(environment));
+}
+
+VaryingValue VaryingCondition::evaluateValue(const VaryingEnvironment &environment) const {
+    std::array<VaryingValue, MaxStackDepth> stack;
+    std::size_t top = 0;
+
+    const auto size = _instructions.size();
+    for (std::size_t pc = 0; pc < size; ++pc) {
+        const auto &instruction = _instructions[pc];
+
+        switch (instruction.op) {
+            case OpCode::PushConstant:
+                stack[top++] = std::visit([](const auto &value) -> VaryingValue {
+                    if constexpr (std::is_same_v<std::decay_t<decltype(value)>, std::wstring>) {
+                        return std::wstring_view(value);
+                    } else {
+                        return value;
+                    }
+                },
+                                          _constants[instruction.operand]);
+                break;
+            case OpCode::PushVariable:
+                stack[top++] = environment.get(_variables[instruction.operand]);
+                break;
+            case OpCode::Not:
+                stack[top - 1] = !detail::isTruthy(stack[top - 1]);
+                break;
+            case OpCode::Negate:
+                if (const auto *i = std::get_if<int64>(&stack[top - 1])) {
+                    stack[top - 1] = detail::arithmetic(OpCode::Subtract, int64{0}, *i);
+                } else if (const auto *d = std::get_if<double>(&stack[top - 1])) {
+                    stack[top - 1] = -*d;
+                } else {
+                    stack[top - 1] = std::monostate();
+                }
+                break;
+            case OpCode::ToBool:
+                stack[top - 1] = detail::isTruthy(stack[top - 1]);
+                break;
+            case OpCode::JumpIfFalse:
+            case OpCode::JumpIfTrue:
+                if (detail::isTruthy(stack[top - 1]) == (instruction.op == OpCode::JumpIfTrue)) {
+                    stack[top - 1] = instruction.op == OpCode::JumpIfTrue;
+                    pc = instruction.operand - 1;
+                } else {
+                    top--;
+                }
+                break;
+            case OpCode::Multiply:
+            case OpCode::Divide:
+            case OpCode::Modulo:
+            case OpCode::Add:
+            case OpCode::Subtract:
+                top--;
+                stack[top - 1] = detail::arithmetic(instruction.op, stack[top - 1], stack[top]);
+                break;
+            default: {
+                top--;
+                const auto ordering = detail::compare(stack[top - 1], stack[top]);
+                bool result = false;
+                switch (instruction.op) {
+                    case OpCode::Less: result = ordering < 0; break;
+                    case OpCode::LessEqual: result = ordering <= 0; break;
+                    case OpCode::Greater: result = ordering > 0; break;
+                    case OpCode::GreaterEqual: result = ordering >= 0; break;
+                    case OpCode::Equal: result = ordering == 0; break;
+                    case OpCode::NotEqual: result = ordering != 0; break;
+                    default: break;
+                }
+                stack[top - 1] = result;
+                break;
+            }
+        }
+    }
+
+    return top > 0 ? stack[top - 1] : VaryingValue(true);
+}
+
+}// namespace eni
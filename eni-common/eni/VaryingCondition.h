@@ -0,0 +1,169 @@
+//
+// Created by void on 10/18/26.
+//
+
+#ifndef ENI_VARYING_CONDITION_H
+#define ENI_VARYING_CONDITION_H
+
+#include <eni/build_config.h>
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+namespace eni {
+
+/**
+ * A value a condition operates on. Strings are borrowed from the environment or the condition itself.
+ */
+using VaryingValue = std::variant<std::monostate, bool, int64, double, std::wstring_view>;
+
+/**
+ * The variables a condition is evaluated against.
+ */
+class VaryingEnvironment {
+public:
+    virtual ~VaryingEnvironment() = default;
+
+    /**
+     * @param name The name of the variable.
+     * @return The value of the variable or std::monostate if it is not defined.
+     */
+    [[nodiscard]] virtual VaryingValue get(std::wstring_view name) const = 0;
+};
+
+/**
+ * A VaryingEnvironment that owns its variables.
+ */
+class VaryingVariables : public VaryingEnvironment {
+public:
+    using value_type = std::variant<std::monostate, bool, int64, double, std::wstring>;
+
+    void set(std::wstring name, value_type value);
+    void unset(std::wstring_view name);
+
+    [[nodiscard]] VaryingValue get(std::wstring_view name) const override;
+
+private:
+    struct Hash {
+        using is_transparent = void;
+        std::size_t operator()(std::wstring_view str) const { return std::hash<std::wstring_view>{}(str); }
+    };
+
+    std::unordered_map<std::wstring, value_type, Hash, std::equal_to<>> _variables;
+};
+
+/**
+ * A compiled VaryingConditional::condition.
+ *
+ * Conditions are boolean expressions over the variables of a VaryingEnvironment:
+ *
+ *     quality >= 2 && (platform == 'linux' || !lowMemory)
+ *
+ * Supported are integer, floating point, string ('...' or "...") and boolean literals, null, variables, the operators
+ * ! - * / % + < <= > >= == != && || (and the aliases not, and, or) and parentheses. && and || short-circuit. Undefined
+ * variables are null, which only equals null. Integer results that overflow are computed as floating point numbers
+ * instead, division and modulo by zero are null. An empty condition is always true.
+ *
+ * A condition is compiled once into a compact stack-based bytecode; evaluating it does not allocate.
+ */
+class VaryingCondition {
+public:
+    /// The maximum operand stack depth of a condition.
+    static constexpr std::size_t MaxStackDepth = 64;
+
+    /// The maximum nesting of parentheses and unary operators of a condition.
+    static constexpr std::size_t MaxNestingDepth = 256;
+
+    /// The number of conditions kept by the cache of compile().
+    static constexpr std::size_t CacheCapacity = 1024;
+
+    /**
+     * Compiles a condition.
+     * @param source The condition.
+     * @throws ParseException if the condition is malformed.
+     */
+    explicit VaryingCondition(std::wstring_view source);
+
+    /**
+     * Compiles a condition or returns it from the process-wide cache, which keeps the CacheCapacity most recently used
+     * conditions.
+     * @param source The condition.
+     * @return The compiled condition.
+     * @throws ParseException if the condition is malformed.
+     */
+    static std::shared_ptr<const VaryingCondition> compile(std::wstring_view source);
+
+    /**
+     * Evaluates the condition.
+     * @param environment The variables to evaluate against.
+     * @return Whether the condition holds.
+     */
+    [[nodiscard]] bool evaluate(const VaryingEnvironment &environment) const;
+
+    /**
+     * Evaluates the condition and returns its raw result.
+     * @param environment The variables to evaluate against.
+     * @return The resulting value, strings refer into the environment or this condition.
+     */
+    [[nodiscard]] VaryingValue evaluateValue(const VaryingEnvironment &environment) const;
+
+    /**
+     * @return The source of the condition.
+     */
+    [[nodiscard]] const std::wstring &getSource() const { return _source; }
+
+    /**
+     * @return The names of all variables the condition refers to.
+     */
+    [[nodiscard]] const std::vector<std::wstring> &getVariables() const { return _variables; }
+
+public:
+    enum class OpCode : uint8 {
+        PushConstant,
+        PushVariable,
+        Not,
+        Negate,
+        Multiply,
+        Divide,
+        Modulo,
+        Add,
+        Subtract,
+        Less,
+        LessEqual,
+        Greater,
+        GreaterEqual,
+        Equal,
+        NotEqual,
+        JumpIfFalse,//< Jumps if the top of the stack is falsy, popping it otherwise.
+        JumpIfTrue, //< Jumps if the top of the stack is truthy, popping it otherwise.
+        ToBool,
+    };
+
+    struct Instruction {
+        OpCode op;
+        uint32 operand;
+    };
+
+    using constant_type = std::variant<std::monostate, bool, int64, double, std::wstring>;
+
+    /**
+     * @return The compiled bytecode.
+     */
+    [[nodiscard]] const std::vector<Instruction> &getInstructions() const { return _instructions; }
+
+private:
+    friend class VaryingConditionCompiler;
+
+    std::wstring _source;
+    std::vector<Instruction> _instructions;
+    std::vector<constant_type> _constants;
+    std::vector<std::wstring> _variables;
+};
+
+}// namespace eni
+
+#endif//ENI_VARYING_CONDITION_H
@@ -0,0 +1,635 @@
+//
+// Created by void on 10/18/26.
+//
+
+#include <eni/VaryingCache.h>
+#include <eni/VaryingPattern.h>
+#include <eni/exception.h>
+
+#include <algorithm>
+#include <cwctype>
+#include <map>
+
+namespace eni {
+
+namespace detail {
+constexpr uint32 MaxPatternChar = 0x10FFFF;
+constexpr uint32 MaxPatternRepeat = 1000;
+constexpr std::size_t MaxNfaStates = 65536;
+
+struct PatternRange {
+    uint32 lo;
+    uint32 hi;
+};
+
+struct PatternNode {
+    enum class Type : uint8 {
+        Empty,
+        Set,
+        Concat,
+        Alternate,
+        Repeat
+    };
+
+    Type type = Type::Empty;
+    std::vector<PatternRange> ranges;
+    std::vector<PatternNode> children;
+    uint32 min = 0;
+    uint32 max = 0;
+    bool unbounded = false;
+    uint32 height = 1;//< The number of levels of the tree rooted at this node.
+
+    static PatternNode make(Type type) {
+        PatternNode node;
+        node.type = type;
+        return node;
+    }
+
+    static PatternNode makeSet(std::vector<PatternRange> ranges) {
+        auto node = make(Type::Set);
+        node.ranges = std::move(ranges);
+        return node;
+    }
+};
+
+/**
+ * Thrown while compiling a pattern that is not supported by the automaton, which makes it fall back to std::wregex.
+ */
+struct UnsupportedPattern {};
+
+inline bool isLineTerminator(wchar_t c) {
+    return c == L'\n' || c == L'\r' || c == 0x2028 || c == 0x2029;
+}
+
+inline std::vector<PatternRange> complement(std::vector<PatternRange> ranges) {
+    std::ranges::sort(ranges, {}, &PatternRange::lo);
+
+    std::vector<PatternRange> result;
+    uint32 next = 0;
+    for (const auto &range : ranges) {
+        if (range.lo > next) {
+            result.push_back({next, range.lo - 1});
+        }
+        next = std::max(next, range.hi + 1);
+    }
+    if (next <= MaxPatternChar) {
+        result.push_back({next, MaxPatternChar});
+    }
+    return result;
+}
+
+inline std::vector<PatternRange> getDotRanges() {
+    return complement({{L'\n', L'\n'}, {L'\r', L'\r'}, {0x2028, 0x2029}});
+}
+}// namespace detail
+
+/**
+ * Parses a pattern and compiles it into a DFA.
+ */
+class VaryingPatternCompiler {
+    using Node = detail::PatternNode;
+    using Range = detail::PatternRange;
+
+    struct NfaState {
+        std::vector<Range> ranges;
+        int32 next = -1;
+        std::vector<int32> epsilon;
+    };
+
+    struct Fragment {
+        int32 start;
+        int32 end;
+    };
+
+public:
+    VaryingPatternCompiler(VaryingPattern &pattern, std::wstring_view source) : _pattern(pattern), _source(source) {}
+
+    void compile() {
+        if (_source == L".*" || _source == L"^.*$") {
+            _pattern._kind = VaryingPattern::Kind::Any;
+            return;
+        }
+
+        const auto root = _parseAlternation();
+        if (_position != _source.size()) {
+            throw detail::UnsupportedPattern();
+        }
+
+        if (std::wstring literal; _collectLiteral(root, literal)) {
+            _pattern._kind = VaryingPattern::Kind::Literal;
+            _pattern._literal = std::move(literal);
+            return;
+        }
+
+        const auto fragment = _build(root);
+        _buildDfa(fragment);
+        _pattern._kind = VaryingPattern::Kind::Dfa;
+    }
+
+private:
+    // Parsing
+
+    [[nodiscard]] bool _atEnd() const { return _position >= _source.size(); }
+    [[nodiscard]] wchar_t _peek() const { return _source[_position]; }
+
+    /**
+     * Adds a child to a node. The tree is walked recursively, so its height is bounded here; std::wregex would recurse
+     * just as deeply, so too deep patterns are rejected rather than falling back to it.
+     */
+    void _adopt(Node &parent, Node child) const {
+        parent.height = std::max(parent.height, child.height + 1);
+        if (parent.height > VaryingPattern::MaxNestingDepth) {
+            _failNesting();
+        }
+        parent.children.push_back(std::move(child));
+    }
+
+    [[noreturn]] void _failNesting() const {
+        throw ParseException("Invalid Varying pattern: nested too deeply at position " + std::to_string(_position));
+    }
+
+    Node _parseAlternation() {
+        auto alternation = Node::make(Node::Type::Alternate);
+        _adopt(alternation, _parseSequence());
+
+        while (!_atEnd() && _peek() == L'|') {
+            _position++;
+            _adopt(alternation, _parseSequence());
+        }
+
+        if (alternation.children.size() == 1) {
+            return std::move(alternation.children.front());
+        }
+        return alternation;
+    }
+
+    Node _parseSequence() {
+        auto sequence = Node::make(Node::Type::Concat);
+        while (!_atEnd() && _peek() != L'|' && _peek() != L')') {
+            _adopt(sequence, _parseQuantified());
+        }
+        return sequence;
+    }
+
+    [[nodiscard]] bool _atQuantifier() const {
+        return !_atEnd() && (_peek() == L'*' || _peek() == L'+' || _peek() == L'?' || _peek() == L'{');
+    }
+
+    Node _parseQuantified() {
+        auto atom = _parseAtom();
+
+        if (_atQuantifier()) {
+            auto repeat = Node::make(Node::Type::Repeat);
+            const auto c = _peek();
+
+            if (c == L'*') {
+                repeat.unbounded = true;
+            } else if (c == L'+') {
+                repeat.min = 1;
+                repeat.unbounded = true;
+            } else if (c == L'?') {
+                repeat.max = 1;
+            } else if (c == L'{') {
+                _position++;
+                repeat.min = _parseNumber();
+                repeat.max = repeat.min;
+                if (!_atEnd() && _peek() == L',') {
+                    _position++;
+                    if (!_atEnd() && _peek() == L'}') {
+                        repeat.unbounded = true;
+                    } else {
+                        repeat.max = _parseNumber();
+                    }
+                }
+                if (_atEnd() || _peek() != L'}' || (!repeat.unbounded && repeat.max < repeat.min)) {
+                    throw detail::UnsupportedPattern();
+                }
+            }
+
+            _position++;
+
+            // Lazy quantifiers only change which match is found, not whether the whole value matches.
+            if (!_atEnd() && _peek() == L'?') {
+                _position++;
+            }
+
+            // ECMAScript does not allow to quantify a quantifier. Some std::wregex implementations accept it nonetheless,
+            // so it is rejected here rather than given whatever meaning the fallback would give it.
+            if (_atQuantifier()) {
+                throw ParseException("Invalid Varying pattern: nothing to repeat at position " + std::to_string(_position));
+            }
+
+            _adopt(repeat, std::move(atom));
+            atom = std::move(repeat);
+        }
+
+        return atom;
+    }
+
+    Node _parseAtom() {
+        const auto c = _source[_position++];
+
+        switch (c) {
+            case L'(': {
+                if (++_groupDepth > VaryingPattern::MaxNestingDepth) {
+                    _failNesting();
+                }
+                if (!_atEnd() && _peek() == L'?') {
+                    if (_source.substr(_position, 2) != L"?:") {
+                        throw detail::UnsupportedPattern();
+                    }
+                    _position += 2;
+                }
+                auto group = _parseAlternation();
+                if (_atEnd() || _peek() != L')') {
+                    throw detail::UnsupportedPattern();
+                }
+                _position++;
+                _groupDepth--;
+                return group;
+            }
+            case L'[':
+                return _parseClass();
+            case L'.':
+                return Node::makeSet(detail::getDotRanges());
+            case L'\\':
+                return Node::makeSet(_parseEscape(false));
+            case L'^':
+                if (_position != 1) {
+                    throw detail::UnsupportedPattern();
+                }
+                return {};
+            case L'$':
+                if (_position != _source.size()) {
+                    throw detail::UnsupportedPattern();
+                }
+                return {};
+            case L'*':
+            case L'+':
+            case L'?':
+            case L'{':
+            case L'}':
+            case L']':
+            case L')':
+                throw detail::UnsupportedPattern();
+            default:
+                return Node::makeSet({{static_cast<uint32>(c), static_cast<uint32>(c)}});
+        }
+    }
+
+    Node _parseClass() {
+        bool negated = false;
+        if (!_atEnd() && _peek() == L'^') {
+            negated = true;
+            _position++;
+        }
+
+        std::vector<Range> ranges;
+        while (!_atEnd() && _peek() != L']') {
+            auto from = _parseClassAtom();
+            if (from.size() == 1 && from[0].lo == from[0].hi && _position + 1 < _source.size() && _peek() == L'-' && _source[_position + 1] != L']') {
+                _position++;
+                auto to = _parseClassAtom();
+                if (to.size() != 1 || to[0].lo != to[0].hi || to[0].lo < from[0].lo) {
+                    throw detail::UnsupportedPattern();
+                }
+                ranges.push_back({from[0].lo, to[0].lo});
+            } else {
+                ranges.insert(ranges.end(), from.begin(), from.end());
+            }
+        }
+
+        if (_atEnd()) {
+            throw detail::UnsupportedPattern();
+        }
+        _position++;
+
+        return Node::makeSet(negated ? detail::complement(std::move(ranges)) : std::move(ranges));
+    }
+
+    std::vector<Range> _parseClassAtom() {
+        const auto c = _source[_position++];
+        if (c == L'\\') {
+            return _parseEscape(true);
+        }
+        return {{static_cast<uint32>(c), static_cast<uint32>(c)}};
+    }
+
+    std::vector<Range> _parseEscape(bool inClass) {
+        if (_atEnd()) {
+            throw detail::UnsupportedPattern();
+        }
+
+        static const std::vector<Range> digit = {{L'0', L'9'}};
+        static const std::vector<Range> word = {{L'0', L'9'}, {L'A', L'Z'}, {L'_', L'_'}, {L'a', L'z'}};
+        static const std::vector<Range> space = {{L'\t', L'\r'}, {L' ', L' '}};
+
+        const auto c = _source[_position++];
+        auto single = [](uint32 x) { return std::vector<Range>{{x, x}}; };
+
+        switch (c) {
+            case L'd': return digit;
+            case L'D': return detail::complement(digit);
+            case L'w': return word;
+            case L'W': return detail::complement(word);
+            case L's': return space;
+            case L'S': return detail::complement(space);
+            case L't': return single(L'\t');
+            case L'n': return single(L'\n');
+            case L'r': return single(L'\r');
+            case L'f': return single(L'\f');
+            case L'v': return single(L'\v');
+            case L'0': return single(0);
+            case L'b': return inClass ? single(L'\b') : throw detail::UnsupportedPattern();
+            case L'x': return single(_parseHex(2));
+            case L'u': return single(_parseHex(4));
+            default:
+                if (std::iswalnum(c)) {
+                    // Backreferences and other escapes not handled here
+                    throw detail::UnsupportedPattern();
+                }
+                return single(static_cast<uint32>(c));
+        }
+    }
+
+    uint32 _parseHex(std::size_t digits) {
+        uint32 value = 0;
+        for (std::size_t i = 0; i < digits; ++i) {
+            if (_atEnd() || !std::iswxdigit(_peek())) {
+                throw detail::UnsupportedPattern();
+            }
+            const auto c = _source[_position++];
+            value = value * 16 + static_cast<uint32>(std::iswdigit(c) ? c - L'0' : (std::towlower(c) - L'a' + 10));
+        }
+        return value;
+    }
+
+    uint32 _parseNumber() {
+        uint32 value = 0;
+        const auto start = _position;
+        while (!_atEnd() && std::iswdigit(_peek())) {
+            value = value * 10 + static_cast<uint32>(_source[_position++] - L'0');
+            if (value > detail::MaxPatternRepeat) {
+                throw detail::UnsupportedPattern();
+            }
+        }
+        if (_position == start) {
+            throw detail::UnsupportedPattern();
+        }
+        return value;
+    }
+
+    static bool _collectLiteral(const Node &node, std::wstring &literal) {
+        switch (node.type) {
+            case Node::Type::Empty:
+                return true;
+            case Node::Type::Set:
+                if (node.ranges.size() == 1 && node.ranges[0].lo == node.ranges[0].hi) {
+                    literal += static_cast<wchar_t>(node.ranges[0].lo);
+                    return true;
+                }
+                return false;
+            case Node::Type::Concat:
+                return std::ranges::all_of(node.children, [&literal](const auto &child) { return _collectLiteral(child, literal); });
+            default:
+                return false;
+        }
+    }
+
+    // NFA construction
+
+    int32 _addState() {
+        if (_nfa.size() >= detail::MaxNfaStates) {
+            throw detail::UnsupportedPattern();
+        }
+        _nfa.emplace_back();
+        return static_cast<int32>(_nfa.size() - 1);
+    }
+
+    Fragment _build(const Node &node) {
+        switch (node.type) {
+            case Node::Type::Set: {
+                const auto start = _addState();
+                const auto end = _addState();
+                _nfa[start].ranges = node.ranges;
+                _nfa[start].next = end;
+                return {start, end};
+            }
+            case Node::Type::Concat: {
+                if (node.children.empty()) {
+                    return _build(Node{});
+                }
+                auto fragment = _build(node.children.front());
+                for (std::size_t i = 1; i < node.children.size(); ++i) {
+                    const auto next = _build(node.children[i]);
+                    _nfa[fragment.end].epsilon.push_back(next.start);
+                    fragment.end = next.end;
+                }
+                return fragment;
+            }
+            case Node::Type::Alternate: {
+                const auto start = _addState();
+                const auto end = _addState();
+                for (const auto &child : node.children) {
+                    const auto fragment = _build(child);
+                    _nfa[start].epsilon.push_back(fragment.start);
+                    _nfa[fragment.end].epsilon.push_back(end);
+                }
+                return {start, end};
+            }
+            case Node::Type::Repeat: {
+                const auto start = _addState();
+                auto end = start;
+                const auto &child = node.children.front();
+
+                for (uint32 i = 0; i < node.min; ++i) {
+                    const auto fragment = _build(child);
+                    _nfa[end].epsilon.push_back(fragment.start);
+                    end = fragment.end;
+                }
+
+                if (node.unbounded) {
+                    const auto fragment = _build(child);
+                    const auto loopEnd = _addState();
+                    _nfa[end].epsilon.push_back(fragment.start);
+                    _nfa[end].epsilon.push_back(loopEnd);
+                    _nfa[fragment.end].epsilon.push_back(fragment.start);
+                    _nfa[fragment.end].epsilon.push_back(loopEnd);
+                    end = loopEnd;
+                } else if (node.max > node.min) {
+                    const auto optionalEnd = _addState();
+                    for (uint32 i = node.min; i < node.max; ++i) {
+                        const auto fragment = _build(child);
+                        _nfa[end].epsilon.push_back(fragment.start);
+                        _nfa[end].epsilon.push_back(optionalEnd);
+                        end = fragment.end;
+                    }
+                    _nfa[end].epsilon.push_back(optionalEnd);
+                    end = optionalEnd;
+                }
+
+                return {start, end};
+            }
+            case Node::Type::Empty:
+            default: {
+                const auto start = _addState();
+                const auto end = _addState();
+                _nfa[start].epsilon.push_back(end);
+                return {start, end};
+            }
+        }
+    }
+
+    // DFA construction
+
+    void _closure(std::vector<int32> &states) const {
+        std::vector<bool> seen(_nfa.size());
+        std::vector<int32> stack = states;
+        for (const auto s : states) {
+            seen[s] = true;
+        }
+
+        while (!stack.empty()) {
+            const auto s = stack.back();
+            stack.pop_back();
+            for (const auto t : _nfa[s].epsilon) {
+                if (!seen[t]) {
+                    seen[t] = true;
+                    states.push_back(t);
+                    stack.push_back(t);
+                }
+            }
+        }
+
+        std::ranges::sort(states);
+    }
+
+    void _buildDfa(const Fragment &fragment) {
+        // Split the alphabet into classes of characters that no transition distinguishes.
+        auto &boundaries = _pattern._classBoundaries;
+        boundaries.push_back(0);
+        for (const auto &state : _nfa) {
+            for (const auto &range : state.ranges) {
+                boundaries.push_back(range.lo);
+                if (range.hi < detail::MaxPatternChar) {
+                    boundaries.push_back(range.hi + 1);
+                }
+            }
+        }
+        std::ranges::sort(boundaries);
+        boundaries.erase(std::unique(boundaries.begin(), boundaries.end()), boundaries.end());
+
+        const auto classCount = static_cast<uint32>(boundaries.size());
+        _pattern._classCount = classCount;
+        for (uint32 c = 0; c < _pattern._asciiClasses.size(); ++c) {
+            _pattern._asciiClasses[c] = static_cast<uint32>(std::ranges::upper_bound(boundaries, c) - boundaries.begin() - 1);
+        }
+
+        std::map<std::vector<int32>, int32> dfaStates;
+        std::vector<std::vector<int32>> worklist;
+
+        auto addDfaState = [&](std::vector<int32> states) {
+            if (auto it = dfaStates.find(states); it != dfaStates.end()) {
+                return it->second;
+            }
+            if (dfaStates.size() >= VaryingPattern::MaxStates) {
+                throw detail::UnsupportedPattern();
+            }
+
+            const auto index = static_cast<int32>(dfaStates.size());
+            _pattern._accepting.push_back(std::ranges::binary_search(states, fragment.end));
+            _pattern._transitions.resize(_pattern._transitions.size() + classCount, -1);
+            dfaStates.emplace(states, index);
+            worklist.push_back(std::move(states));
+            return index;
+        };
+
+        std::vector<int32> start{fragment.start};
+        _closure(start);
+        addDfaState(std::move(start));
+
+        for (std::size_t current = 0; current < worklist.size(); ++current) {
+            for (uint32 k = 0; k < classCount; ++k) {
+                const auto representative = boundaries[k];
+
+                std::vector<int32> targets;
+                for (const auto s : worklist[current]) {
+                    const auto &state = _nfa[s];
+                    if (std::ranges::any_of(state.ranges, [representative](const auto &r) { return r.lo <= representative && representative <= r.hi; })) {
+                        targets.push_back(state.next);
+                    }
+                }
+
+                if (targets.empty()) {
+                    continue;
+                }
+
+                _closure(targets);
+                targets.erase(std::unique(targets.begin(), targets.end()), targets.end());
+                const auto target = addDfaState(std::move(targets));
+                _pattern._transitions[current * classCount + k] = target;
+            }
+        }
+    }
+
+private:
+    VaryingPattern &_pattern;
+    std::wstring_view _source;
+    std::size_t _position = 0;
+    std::size_t _groupDepth = 0;
+    std::vector<NfaState> _nfa;
+};
+
+VaryingPattern::VaryingPattern(std::wstring_view pattern) : _pattern(pattern) {
+    try {
+        VaryingPatternCompiler(*this, _pattern).compile();
+    } catch (const detail::UnsupportedPattern &) {
+        _classBoundaries.clear();
+        _transitions.clear();
+        _accepting.clear();
+
+        try {
+            _regex = std::make_unique<std::wregex>(_pattern, std::regex_constants::ECMAScript | std::regex_constants::optimize);
+            _kind = Kind::Regex;
+        } catch (const std::regex_error &e) {
+            throw ParseException(std::string("Invalid Varying pattern: ") + e.what());
+        }
+    }
+}
+
+std::shared_ptr<const VaryingPattern> VaryingPattern::compile(std::wstring_view pattern) {
+    static detail::VaryingCompileCache<VaryingPattern> cache(CacheCapacity);
+    return cache.get(pattern);
+}
+
+uint32 VaryingPattern::_getCharClass(wchar_t c) const {
+    const auto code = static_cast<uint32>(c);
+    if (code < _asciiClasses.size()) {
+        return _asciiClasses[code];
+    }
+    return static_cast<uint32>(std::ranges::upper_bound(_classBoundaries, code) - _classBoundaries.begin() - 1);
+}
+
+bool VaryingPattern::matches(std::wstring_view value) const {
+    switch (_kind) {
+        case Kind::Any:
+            return std::ranges::none_of(value, detail::isLineTerminator);
+        case Kind::Literal:
+            return value == _literal;
+        case Kind::Dfa: {
+            int32 state = 0;
+            for (const auto c : value) {
+                state = _transitions[static_cast<std::size_t>(state) * _classCount + _getCharClass(c)];
+                if (state < 0) {
+                    return false;
+                }
+            }
+            return _accepting[state];
+        }
+        case Kind::Regex:
+        default:
+            return std::regex_match(value.begin(), value.end(), *_regex);
+    }
+}
+
+}// namespace eni
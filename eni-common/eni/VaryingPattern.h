@@ -0,0 +1,103 @@
+//
+// Created by void on 10/18/26.
+//
+
+#ifndef ENI_VARYING_PATTERN_H
+#define ENI_VARYING_PATTERN_H
+
+#include <eni/build_config.h>
+
+#include <array>
+#include <memory>
+#include <regex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace eni {
+
+/**
+ * A compiled VaryingString::validPattern.
+ *
+ * Patterns use the ECMAScript syntax of std::wregex and must match the whole value, like std::regex_match(). A pattern
+ * is compiled once into a deterministic finite automaton, so validating a value is a single pass over its characters
+ * without any allocation. The default pattern ".*" and plain literals are recognized and matched without an automaton.
+ *
+ * Supported are literals, escapes (\\d \\w \\s and their negations, \\t \\n \\r \\f \\v \\0 \\xHH \\uHHHH), ".", character
+ * classes, groups, non-capturing groups, alternation, the quantifiers * + ? {n} {n,} {n,m} (lazy variants match the
+ * same values) and ^/$ at the beginning and end of the pattern. Patterns using anything else, e.g. backreferences or
+ * assertions, fall back to std::wregex.
+ */
+class VaryingPattern {
+public:
+    enum class Kind : uint8 {
+        Any,    //< ".*", matches every value without line terminators.
+        Literal,//< Matches exactly one value.
+        Dfa,    //< Matched by the compiled automaton.
+        Regex,  //< Matched by std::wregex.
+    };
+
+    /// The maximum number of automaton states before falling back to std::wregex.
+    static constexpr std::size_t MaxStates = 4096;
+
+    /// The maximum nesting of groups and quantifiers of a pattern.
+    static constexpr std::size_t MaxNestingDepth = 256;
+
+    /// The number of patterns kept by the cache of compile().
+    static constexpr std::size_t CacheCapacity = 1024;
+
+    /**
+     * Compiles a pattern.
+     * @param pattern The pattern.
+     * @throws ParseException if the pattern is malformed or nested deeper than MaxNestingDepth.
+     */
+    explicit VaryingPattern(std::wstring_view pattern);
+
+    /**
+     * Compiles a pattern or returns it from the process-wide cache, which keeps the CacheCapacity most recently used
+     * patterns.
+     * @param pattern The pattern.
+     * @return The compiled pattern.
+     * @throws ParseException if the pattern is malformed.
+     */
+    static std::shared_ptr<const VaryingPattern> compile(std::wstring_view pattern);
+
+    /**
+     * @param value The value to validate.
+     * @return Whether the whole value matches the pattern.
+     */
+    [[nodiscard]] bool matches(std::wstring_view value) const;
+
+    /**
+     * @return How values are matched against this pattern.
+     */
+    [[nodiscard]] Kind getKind() const { return _kind; }
+
+    /**
+     * @return The source of the pattern.
+     */
+    [[nodiscard]] const std::wstring &getPattern() const { return _pattern; }
+
+private:
+    [[nodiscard]] uint32 _getCharClass(wchar_t c) const;
+
+private:
+    friend class VaryingPatternCompiler;
+
+    std::wstring _pattern;
+    Kind _kind = Kind::Regex;
+    std::wstring _literal;
+
+    // The automaton: _transitions[state * _classCount + class] is the next state or -1.
+    std::array<uint32, 128> _asciiClasses{};
+    std::vector<uint32> _classBoundaries;
+    uint32 _classCount = 0;
+    std::vector<int32> _transitions;
+    std::vector<bool> _accepting;
+
+    std::unique_ptr<std::wregex> _regex;
+};
+
+}// namespace eni
+
+#endif//ENI_VARYING_PATTERN_H
@@ -0,0 +1,75 @@
+//
+// Created by void on 10/18/26.
+//
+
+#include <eni/VaryingPool.h>
+
+#include <cassert>
+#include <mutex>
+
+namespace eni {
+
+VaryingStringPool::VaryingStringPool() {
+    _strings.emplace_back();
+    _ids.emplace(std::wstring_view(), 0);
+}
+
+VaryingStringPool &VaryingStringPool::global() {
+    static VaryingStringPool pool;
+    return pool;
+}
+
+VaryingStringId VaryingStringPool::intern(std::wstring_view str) {
+    {
+        auto lk = std::shared_lock(_mutex);
+        if (auto it = _ids.find(str); it != _ids.end()) {
+            return it->second;
+        }
+    }
+
+    auto lk = std::unique_lock(_mutex);
+    if (auto it = _ids.find(str); it != _ids.end()) {
+        return it->second;
+    }
+
+    const auto id = static_cast<VaryingStringId>(_strings.size());
+    const auto stored = _arena.store(str);
+    _strings.push_back(stored);
+    _ids.emplace(stored, id);
+    return id;
+}
+
+InternedVaryingString VaryingStringPool::intern(const VaryingString &varying) {
+    return {intern(varying.condition), intern(varying.validPattern), intern(varying.defaultValue)};
+}
+
+InternedVarying VaryingStringPool::intern(const Varying &varying) {
+    return std::visit([this](const auto &v) -> InternedVarying { return intern(v); }, varying);
+}
+
+std::wstring_view VaryingStringPool::get(VaryingStringId id) const {
+    auto lk = std::shared_lock(_mutex);
+    assert(id < _strings.size());
+    return _strings[id];
+}
+
+VaryingString VaryingStringPool::resolve(const InternedVaryingString &varying) const {
+    auto lk = std::shared_lock(_mutex);
+    return VaryingString(std::wstring(_strings[varying.condition]), std::wstring(_strings[varying.validPattern]),
+                         std::wstring(_strings[varying.defaultValue]));
+}
+
+Varying VaryingStringPool::resolve(const InternedVarying &varying) const {
+    return std::visit([this](const auto &v) -> Varying { return resolve(v); }, varying);
+}
+
+std::size_t VaryingStringPool::size() const {
+    auto lk = std::shared_lock(_mutex);
+    return _strings.size();
+}
+
+std::size_t VaryingStringPool::getBytes() const {
+    return _arena.getBytes();
+}
+
+}// namespace eni
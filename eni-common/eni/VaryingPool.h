@@ -0,0 +1,162 @@
+//
+// Created by void on 10/18/26.
+//
+
+#ifndef ENI_VARYING_POOL_H
+#define ENI_VARYING_POOL_H
+
+#include <eni/Varying.h>
+#include <eni/build_config.h>
+#include <eni/strings/string_arena.h>
+
+#include <functional>
+#include <memory>
+#include <shared_mutex>
+#include <string_view>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+namespace eni {
+
+/**
+ * The id of a string interned in a VaryingStringPool.
+ */
+using VaryingStringId = uint32;
+
+/**
+ * A VaryingString whose strings are interned in a VaryingStringPool.
+ */
+struct InternedVaryingString {
+    VaryingStringId condition = 0;
+    VaryingStringId validPattern = 0;
+    VaryingStringId defaultValue = 0;
+
+    [[nodiscard]] bool operator==(const InternedVaryingString &other) const = default;
+};
+
+/**
+ * A VaryingNumeric whose condition is interned in a VaryingStringPool.
+ */
+template<typename T>
+struct InternedVaryingNumeric {
+    using value_type = T;
+
+    VaryingStringId condition = 0;
+    T defaultValue = 0;
+    T minValue = 0;
+    T maxValue = 0;
+
+    [[nodiscard]] bool operator==(const InternedVaryingNumeric &other) const {
+        return other.condition == condition && detail::varying_value_equal(other.defaultValue, defaultValue) &&
+               detail::varying_value_equal(other.minValue, minValue) && detail::varying_value_equal(other.maxValue, maxValue);
+    }
+};
+
+using InternedVaryingLong = InternedVaryingNumeric<int64>;
+using InternedVaryingFloat = InternedVaryingNumeric<double>;
+
+using InternedVarying = std::variant<
+        InternedVaryingString,
+        InternedVaryingLong,
+        InternedVaryingFloat>;
+
+/**
+ * Deduplicated storage for the strings of Varying definitions.
+ *
+ * Large catalogs of Varyings repeat the same conditions, patterns and default values over and over. Interned, every
+ * distinct string is stored once and a definition shrinks to a few 32-bit ids, which compare and hash as plain integers.
+ * The empty string always has the id 0.
+ *
+ * Strings are never removed, so ids and the views returned by get() stay valid for the lifetime of the pool. The pool
+ * is thread-safe.
+ */
+class VaryingStringPool {
+public:
+    VaryingStringPool();
+
+    VaryingStringPool(const VaryingStringPool &) = delete;
+    VaryingStringPool &operator=(const VaryingStringPool &) = delete;
+
+    /**
+     * @return The process-wide pool.
+     */
+    static VaryingStringPool &global();
+
+    /**
+     * Interns a string.
+     * @param str The string.
+     * @return The id of the string, equal strings have equal ids.
+     */
+    VaryingStringId intern(std::wstring_view str);
+
+    InternedVaryingString intern(const VaryingString &varying);
+
+    template<typename T>
+    InternedVaryingNumeric<T> intern(const VaryingNumeric<T> &varying) {
+        return {intern(varying.condition), varying.defaultValue, varying.minValue, varying.maxValue};
+    }
+
+    InternedVarying intern(const Varying &varying);
+
+    /**
+     * @param id The id of an interned string.
+     * @return The interned string.
+     */
+    [[nodiscard]] std::wstring_view get(VaryingStringId id) const;
+
+    /**
+     * Restores the definition an interned Varying has been created from.
+     */
+    [[nodiscard]] VaryingString resolve(const InternedVaryingString &varying) const;
+
+    template<typename T>
+    [[nodiscard]] VaryingNumeric<T> resolve(const InternedVaryingNumeric<T> &varying) const {
+        return VaryingNumeric<T>(std::wstring(get(varying.condition)), varying.minValue, varying.maxValue, varying.defaultValue);
+    }
+
+    [[nodiscard]] Varying resolve(const InternedVarying &varying) const;
+
+    /**
+     * @return The number of distinct strings, including the empty string.
+     */
+    [[nodiscard]] std::size_t size() const;
+
+    /**
+     * @return The memory held by the string data.
+     */
+    [[nodiscard]] std::size_t getBytes() const;
+
+private:
+    struct Hash {
+        using is_transparent = void;
+        std::size_t operator()(std::wstring_view str) const { return std::hash<std::wstring_view>{}(str); }
+    };
+
+    mutable std::shared_mutex _mutex;
+    strings::basic_string_arena<wchar_t> _arena;
+    std::vector<std::wstring_view> _strings;
+    std::unordered_map<std::wstring_view, VaryingStringId, Hash, std::equal_to<>> _ids;
+};
+
+}// namespace eni
+
+template<>
+struct std::hash<eni::InternedVaryingString> {
+    std::size_t operator()(const eni::InternedVaryingString &varying) const noexcept {
+        const auto ids = (static_cast<eni::uint64>(varying.condition) << 32) | varying.validPattern;
+        return eni::detail::hash_combine(std::hash<eni::uint64>{}(ids), varying.defaultValue);
+    }
+};
+
+template<typename T>
+struct std::hash<eni::InternedVaryingNumeric<T>> {
+    std::size_t operator()(const eni::InternedVaryingNumeric<T> &varying) const noexcept {
+        auto seed = std::hash<eni::VaryingStringId>{}(varying.condition);
+        seed = eni::detail::hash_combine(seed, eni::detail::varying_value_hash(varying.defaultValue));
+        seed = eni::detail::hash_combine(seed, eni::detail::varying_value_hash(varying.minValue));
+        return eni::detail::hash_combine(seed, eni::detail::varying_value_hash(varying.maxValue));
+    }
+};
+
+#endif//ENI_VARYING_POOL_H
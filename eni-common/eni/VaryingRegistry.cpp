@@ -0,0 +1,36 @@
+//
+// Created by void on 10/18/26.
+//
+
+#include <eni/VaryingRegistry.h>
+
+#include <cassert>
+#include <mutex>
+
+namespace eni {
+
+VaryingId VaryingRegistry::add(const Varying &varying) {
+    if (auto id = find(varying)) {
+        return *id;
+    }
+
+    auto lk = std::unique_lock(_mutex);
+    const auto [it, inserted] = _ids.try_emplace(varying, static_cast<VaryingId>(_varyings.size()));
+    if (inserted) {
+        _varyings.push_back(&it->first);
+    }
+    return it->second;
+}
+
+const Varying &VaryingRegistry::get(VaryingId id) const {
+    auto lk = std::shared_lock(_mutex);
+    assert(id < _varyings.size());
+    return *_varyings[id];
+}
+
+std::size_t VaryingRegistry::size() const {
+    auto lk = std::shared_lock(_mutex);
+    return _varyings.size();
+}
+
+}// namespace eni
@@ -0,0 +1,98 @@
+//
+// Created by void on 10/18/26.
+//
+
+#ifndef ENI_VARYING_REGISTRY_H
+#define ENI_VARYING_REGISTRY_H
+
+#include <eni/Varying.h>
+#include <eni/build_config.h>
+
+#include <optional>
+#include <shared_mutex>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace eni {
+
+namespace detail {
+template<typename T, typename VariantT>
+struct variant_index;
+
+template<typename T, typename... Ts>
+struct variant_index<T, std::variant<Ts...>> {
+    static constexpr std::size_t value = [] {
+        std::size_t i = 0;
+        ((std::is_same_v<T, Ts> ? false : (++i, true)) && ...);
+        return i;
+    }();
+};
+}// namespace detail
+
+/**
+ * The id of a Varying in a VaryingRegistry.
+ */
+using VaryingId = uint32;
+
+/**
+ * Deduplicates Varying definitions.
+ *
+ * Identical definitions are stored once and share an id, so the registry doubles as an O(1) index from a definition to
+ * its id. Lookups accept the Varying variant as well as any of its alternatives. The registry is thread-safe; the
+ * references returned by get() stay valid for its lifetime.
+ */
+class VaryingRegistry {
+public:
+    /**
+     * Adds a Varying unless an identical one has been added before.
+     * @return The id of the Varying.
+     */
+    VaryingId add(const Varying &varying);
+
+    /**
+     * @return The id of an identical Varying, if one has been added.
+     */
+    template<typename T>
+        requires std::convertible_to<T, Varying>
+    [[nodiscard]] std::optional<VaryingId> find(const T &varying) const {
+        auto lk = std::shared_lock(_mutex);
+        if (auto it = _ids.find(varying); it != _ids.end()) {
+            return it->second;
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * @param id The id of a Varying.
+     * @return The Varying.
+     */
+    [[nodiscard]] const Varying &get(VaryingId id) const;
+
+    /**
+     * @return The number of distinct Varyings.
+     */
+    [[nodiscard]] std::size_t size() const;
+
+private:
+    struct Hash {
+        using is_transparent = void;
+
+        std::size_t operator()(const Varying &varying) const {
+            return std::visit(*this, varying);
+        }
+
+        template<typename T>
+        std::size_t operator()(const T &varying) const {
+            return detail::hash_combine(std::hash<T>{}(varying), detail::variant_index<T, Varying>::value);
+        }
+    };
+
+    mutable std::shared_mutex _mutex;
+    std::unordered_map<Varying, VaryingId, Hash, std::equal_to<>> _ids;
+    std::vector<const Varying *> _varyings;
+};
+
+}// namespace eni
+
+#endif//ENI_VARYING_REGISTRY_H
@@ -6,6 +6,7 @@
 #define ENI_ALGORITHM_H
 
 #include <eni/algorithm/erase_pointer.h>
+#include <eni/algorithm/range_check.h>
 #include <eni/algorithm/tuple.h>
 
 #endif//ENI_ALGORITHM_H
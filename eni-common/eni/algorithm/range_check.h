@@ -0,0 +1,122 @@
+//
+// Created by void on 10/18/26.
+//
+
+#ifndef ENI_ALGORITHM_RANGE_CHECK_H
+#define ENI_ALGORITHM_RANGE_CHECK_H
+
+#include <eni/build_config.h>
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <span>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace eni {
+
+namespace detail {
+template<typename T>
+inline uint64 range_violations_scalar(const T *values, std::size_t count, T minValue, T maxValue) {
+    uint64 mask = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        const auto valid = (values[i] >= minValue) & (values[i] <= maxValue);
+        mask |= static_cast<uint64>(!valid) << i;
+    }
+    return mask;
+}
+
+template<typename T>
+inline uint64 range_violations_block(const T *values, std::size_t count, T minValue, T maxValue) {
+#if defined(__SSE2__)
+    if constexpr (std::same_as<T, double>) {
+        const auto lo = _mm_set1_pd(minValue);
+        const auto hi = _mm_set1_pd(maxValue);
+
+        uint64 mask = 0;
+        std::size_t i = 0;
+        for (; i + 2 <= count; i += 2) {
+            const auto x = _mm_loadu_pd(values + i);
+            const auto valid = _mm_and_pd(_mm_cmpge_pd(x, lo), _mm_cmple_pd(x, hi));
+            mask |= static_cast<uint64>(_mm_movemask_pd(valid) ^ 0b11) << i;
+        }
+        return mask | (range_violations_scalar(values + i, count - i, minValue, maxValue) << i);
+    }
+#endif
+    return range_violations_scalar(values, count, minValue, maxValue);
+}
+}// namespace detail
+
+/**
+ * @brief Checks values against the closed range [minValue, maxValue].
+ *
+ * Values are checked in blocks of 64 into a bitmask, using SSE2 compares for doubles and a branchless loop otherwise.
+ * NaN is always out of range.
+ *
+ * @param values The values to check.
+ * @param minValue The lower bound.
+ * @param maxValue The upper bound.
+ * @param violations Receives the bitmask: bit i % 64 of violations[i / 64] is set if values[i] is out of range. Must
+ *        hold at least (values.size() + 63) / 64 words.
+ * @return The number of values out of range.
+ */
+template<typename T>
+std::size_t range_violations(std::span<const T> values, T minValue, T maxValue, std::span<uint64> violations) {
+    assert(violations.size() >= (values.size() + 63) / 64);
+
+    std::size_t count = 0;
+    for (std::size_t offset = 0, block = 0; offset < values.size(); offset += 64, ++block) {
+        const auto mask = detail::range_violations_block(values.data() + offset, std::min<std::size_t>(64, values.size() - offset), minValue, maxValue);
+        violations[block] = mask;
+        count += static_cast<std::size_t>(std::popcount(mask));
+    }
+    return count;
+}
+
+/**
+ * @brief Clamps values to the closed range [minValue, maxValue] in place.
+ *
+ * Uses SSE2 min/max for doubles and a branchless loop otherwise.
+ *
+ * @param values The values to clamp.
+ * @param minValue The lower bound.
+ * @param maxValue The upper bound.
+ * @param nanValue The value NaN is replaced with before clamping.
+ */
+template<typename T>
+void clamp_range(std::span<T> values, T minValue, T maxValue, T nanValue = {}) {
+    std::size_t i = 0;
+
+#if defined(__SSE2__)
+    if constexpr (std::same_as<T, double>) {
+        const auto lo = _mm_set1_pd(minValue);
+        const auto hi = _mm_set1_pd(maxValue);
+        const auto nan = _mm_set1_pd(nanValue);
+
+        for (; i + 2 <= values.size(); i += 2) {
+            auto x = _mm_loadu_pd(values.data() + i);
+            const auto ordered = _mm_cmpord_pd(x, x);
+            x = _mm_or_pd(_mm_and_pd(ordered, x), _mm_andnot_pd(ordered, nan));
+            _mm_storeu_pd(values.data() + i, _mm_min_pd(_mm_max_pd(x, lo), hi));
+        }
+    }
+#endif
+
+    for (; i < values.size(); ++i) {
+        auto x = values[i];
+        if constexpr (std::floating_point<T>) {
+            // NOLINTNEXTLINE(misc-redundant-expression): false for NaN
+            x = x == x ? x : nanValue;
+        }
+        x = x < minValue ? minValue : x;
+        values[i] = x > maxValue ? maxValue : x;
+    }
+}
+
+}// namespace eni
+
+#endif//ENI_ALGORITHM_RANGE_CHECK_H
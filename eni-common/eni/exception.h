@@ -60,6 +60,12 @@ public:
     using Exception::Exception;
 };
 
+// ReSharper disable once CppClassCanBeFinal
+class ParseException : public Exception {
+public:
+    using Exception::Exception;
+};
+
 }// namespace eni
 
 #endif//ENI_EXCEPTION_H
@@ -5,6 +5,9 @@
 #ifndef ENI_MEMORY_H
 #define ENI_MEMORY_H
 
+#include <eni/memory/ObjectAccounting.h>
+#include <eni/memory/PoolAllocator.h>
+#include <eni/memory/ReleaseQueue.h>
 #include <eni/memory/make_unique_container.h>
 
 #endif//ENI_MEMORY_H
@@ -0,0 +1,159 @@
+//
+// Created by void on 10/18/26.
+//
+
+#include <eni/memory/ObjectAccounting.h>
+
+#include <cxxabi.h>
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <deque>
+#include <map>
+#include <memory>
+#include <ostream>
+#include <typeindex>
+
+namespace eni {
+
+namespace detail {
+struct ObjectAccountingRegistry {
+    static constexpr std::size_t MaxUnreleasedDestructions = 1024;
+
+    std::mutex mutex;
+    std::map<std::type_index, std::unique_ptr<ObjectAccounting::TypeCounters>> types;
+    std::deque<UnreleasedDestruction> unreleased;
+
+    static ObjectAccountingRegistry &get() {
+        static ObjectAccountingRegistry registry;
+        return registry;
+    }
+};
+
+inline double getRate(uint64 count, uint64 lastCount, std::chrono::steady_clock::duration elapsed) {
+    const auto seconds = std::chrono::duration<double>(elapsed).count();
+    return seconds > 0 ? static_cast<double>(count - lastCount) / seconds : 0;
+}
+}// namespace detail
+
+ObjectAccounting::TypeCounters::TypeCounters(std::string typeName, std::size_t objectSize)
+    : _typeName(std::move(typeName)), _objectSize(objectSize) {}
+
+ObjectAccounting::Shard &ObjectAccounting::TypeCounters::acquireShard() {
+    auto lk = std::lock_guard(_mutex);
+    return _shards.emplace_back();
+}
+
+void ObjectAccounting::TypeCounters::retireShard(Shard &shard) {
+    auto lk = std::lock_guard(_mutex);
+    _retiredCreated += shard.created.load(std::memory_order_relaxed);
+    _retiredReleased += shard.released.load(std::memory_order_relaxed);
+    _retiredDestroyed += shard.destroyed.load(std::memory_order_relaxed);
+    _shards.remove_if([&shard](const Shard &s) { return &s == &shard; });
+}
+
+ObjectStatistics ObjectAccounting::TypeCounters::aggregate() {
+    auto lk = std::lock_guard(_mutex);
+
+    ObjectStatistics statistics;
+    statistics.typeName = _typeName;
+    statistics.objectSize = _objectSize;
+    statistics.created = _retiredCreated;
+    statistics.released = _retiredReleased;
+    statistics.destroyed = _retiredDestroyed;
+
+    for (const auto &shard : _shards) {
+        statistics.created += shard.created.load(std::memory_order_relaxed);
+        statistics.released += shard.released.load(std::memory_order_relaxed);
+        statistics.destroyed += shard.destroyed.load(std::memory_order_relaxed);
+    }
+
+    // Shards are read one after another, so an object may be seen destroyed but not yet created.
+    statistics.live = statistics.created > statistics.destroyed ? statistics.created - statistics.destroyed : 0;
+    statistics.bytes = statistics.live * _objectSize;
+
+    statistics.peak = std::max(_peak.load(std::memory_order_relaxed), statistics.live);
+
+    const auto now = std::chrono::steady_clock::now();
+    statistics.createdPerSecond = detail::getRate(statistics.created, _lastCreated, now - _lastAggregation);
+    statistics.releasedPerSecond = detail::getRate(statistics.released, _lastReleased, now - _lastAggregation);
+    _lastCreated = statistics.created;
+    _lastReleased = statistics.released;
+    _lastAggregation = now;
+
+    return statistics;
+}
+
+void ObjectAccounting::recordUnreleasedDestruction(const std::type_info &type, const void *address) {
+    auto &registry = detail::ObjectAccountingRegistry::get();
+    UnreleasedDestruction destruction{getTypeName(type), address, std::this_thread::get_id(), std::chrono::system_clock::now()};
+
+    auto lk = std::lock_guard(registry.mutex);
+    if (registry.unreleased.size() == detail::ObjectAccountingRegistry::MaxUnreleasedDestructions) {
+        registry.unreleased.pop_front();
+    }
+    registry.unreleased.push_back(std::move(destruction));
+}
+
+std::vector<ObjectStatistics> ObjectAccounting::getStatistics() {
+    auto &registry = detail::ObjectAccountingRegistry::get();
+
+    std::vector<TypeCounters *> types;
+    {
+        auto lk = std::lock_guard(registry.mutex);
+        for (auto &[type, counters] : registry.types) {
+            types.push_back(counters.get());
+        }
+    }
+
+    std::vector<ObjectStatistics> result;
+    result.reserve(types.size());
+    for (auto *counters : types) {
+        result.push_back(counters->aggregate());
+    }
+
+    std::ranges::sort(result, std::ranges::greater(), &ObjectStatistics::bytes);
+    return result;
+}
+
+std::vector<UnreleasedDestruction> ObjectAccounting::getUnreleasedDestructions() {
+    auto &registry = detail::ObjectAccountingRegistry::get();
+    auto lk = std::lock_guard(registry.mutex);
+    return {registry.unreleased.begin(), registry.unreleased.end()};
+}
+
+void ObjectAccounting::dump(std::ostream &os) {
+    os << fmt::format("{:<48} {:>12} {:>12} {:>14} {:>12} {:>12}\n", "type", "live", "peak", "bytes", "created/s", "released/s");
+    for (const auto &statistics : getStatistics()) {
+        os << fmt::format("{:<48} {:>12} {:>12} {:>14} {:>12.1f} {:>12.1f}\n", statistics.typeName, statistics.live,
+                          statistics.peak, statistics.bytes, statistics.createdPerSecond, statistics.releasedPerSecond);
+    }
+
+    const auto unreleased = getUnreleasedDestructions();
+    if (!unreleased.empty()) {
+        os << fmt::format("\n{} object(s) destroyed without release():\n", unreleased.size());
+        for (const auto &destruction : unreleased) {
+            os << fmt::format("  {} at {}\n", destruction.typeName, destruction.address);
+        }
+    }
+}
+
+std::string ObjectAccounting::getTypeName(const std::type_info &type) {
+    int status = 0;
+    std::unique_ptr<char, decltype(&std::free)> demangled(abi::__cxa_demangle(type.name(), nullptr, nullptr, &status), &std::free);
+    return status == 0 && demangled ? std::string(demangled.get()) : std::string(type.name());
+}
+
+ObjectAccounting::TypeCounters &ObjectAccounting::registerType(const std::type_info &type, std::size_t objectSize) {
+    auto &registry = detail::ObjectAccountingRegistry::get();
+    auto lk = std::lock_guard(registry.mutex);
+
+    auto &counters = registry.types[std::type_index(type)];
+    if (!counters) {
+        counters = std::make_unique<TypeCounters>(getTypeName(type), objectSize);
+    }
+    return *counters;
+}
+
+}// namespace eni
@@ -0,0 +1,205 @@
+//
+// Created by void on 10/18/26.
+//
+
+#ifndef ENI_MEMORY_OBJECT_ACCOUNTING_H
+#define ENI_MEMORY_OBJECT_ACCOUNTING_H
+
+#include <eni/build_config.h>
+
+#include <atomic>
+#include <chrono>
+#include <iosfwd>
+#include <list>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <typeinfo>
+#include <vector>
+
+namespace eni {
+
+/**
+ * Aggregated object counters of a single type.
+ */
+struct ObjectStatistics {
+    std::string typeName;
+    std::size_t objectSize = 0;
+
+    uint64 created = 0;  //< The total number of objects created.
+    uint64 released = 0; //< The total number of objects released.
+    uint64 destroyed = 0;//< The total number of objects destroyed.
+    uint64 live = 0;     //< The number of objects currently alive.
+    uint64 peak = 0;     //< The highest number of objects alive at the same time.
+    uint64 bytes = 0;    //< The memory held by live objects.
+
+    double createdPerSecond = 0; //< The creation rate since the previous aggregation.
+    double releasedPerSecond = 0;//< The release rate since the previous aggregation.
+};
+
+/**
+ * An object that has been destroyed without being released first.
+ */
+struct UnreleasedDestruction {
+    std::string typeName;
+    const void *address = nullptr;
+    std::thread::id thread;
+    std::chrono::system_clock::time_point time;
+};
+
+/**
+ * Per-type accounting of object lifecycles.
+ *
+ * Each thread counts into its own shard, so recording is free of contention; the shards are only summed up when the
+ * statistics are requested. Only the number of live objects is shared by all threads, so that its peak is exact.
+ * ManagedObject records into it when ENI_MANAGED_OBJECT_ACCOUNTING is defined.
+ */
+class ObjectAccounting {
+public:
+    /**
+     * The counters of a type owned by a single thread.
+     */
+    struct Shard {
+        std::atomic<uint64> created = 0;
+        std::atomic<uint64> released = 0;
+        std::atomic<uint64> destroyed = 0;
+
+        static void increment(std::atomic<uint64> &counter) {
+            // Only the owning thread writes, so a plain load and store is sufficient.
+            counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+    };
+
+    /**
+     * The counters of a single type.
+     */
+    class TypeCounters {
+    public:
+        TypeCounters(std::string typeName, std::size_t objectSize);
+
+        Shard &acquireShard();
+        void retireShard(Shard &shard);
+
+        /**
+         * Counts an object as alive, raising the peak if necessary.
+         */
+        void addLive() {
+            const auto live = _live.fetch_add(1, std::memory_order_relaxed) + 1;
+            auto peak = _peak.load(std::memory_order_relaxed);
+            while (live > peak && !_peak.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+            }
+        }
+
+        void removeLive() { _live.fetch_sub(1, std::memory_order_relaxed); }
+
+        [[nodiscard]] ObjectStatistics aggregate();
+
+    private:
+        std::string _typeName;
+        std::size_t _objectSize;
+
+        std::mutex _mutex;
+        std::list<Shard> _shards;
+        uint64 _retiredCreated = 0;
+        uint64 _retiredReleased = 0;
+        uint64 _retiredDestroyed = 0;
+
+        alignas(64) std::atomic<uint64> _live = 0;
+        std::atomic<uint64> _peak = 0;
+
+        uint64 _lastCreated = 0;
+        uint64 _lastReleased = 0;
+        std::chrono::steady_clock::time_point _lastAggregation = std::chrono::steady_clock::now();
+    };
+
+public:
+    ObjectAccounting() = delete;
+
+    /**
+     * @return The counters of the current thread for type T.
+     */
+    template<typename T>
+    static Shard &getShard() {
+        thread_local ShardHandle handle(getCounters<T>());
+        return handle.shard;
+    }
+
+    template<typename T>
+    static void recordCreated() {
+        Shard::increment(getShard<T>().created);
+        getCounters<T>().addLive();
+    }
+
+    template<typename T>
+    static void recordReleased() { Shard::increment(getShard<T>().released); }
+
+    template<typename T>
+    static void recordDestroyed() {
+        Shard::increment(getShard<T>().destroyed);
+        getCounters<T>().removeLive();
+    }
+
+    template<typename T>
+    static void recordUnreleasedDestruction(const T *object) {
+        recordUnreleasedDestruction(typeid(T), object);
+    }
+
+    static void recordUnreleasedDestruction(const std::type_info &type, const void *address);
+
+    /**
+     * @return The aggregated statistics of type T.
+     */
+    template<typename T>
+    static ObjectStatistics getStatistics() {
+        return getCounters<T>().aggregate();
+    }
+
+    /**
+     * @return The aggregated statistics of all types that have been accounted for.
+     */
+    static std::vector<ObjectStatistics> getStatistics();
+
+    /**
+     * @return The most recent objects that have been destroyed without being released first.
+     */
+    static std::vector<UnreleasedDestruction> getUnreleasedDestructions();
+
+    /**
+     * Writes the statistics of all types and the list of unreleased destructions to a stream.
+     * @param os The stream to write to.
+     */
+    static void dump(std::ostream &os);
+
+    /**
+     * @param type The type.
+     * @return The human-readable name of the type.
+     */
+    static std::string getTypeName(const std::type_info &type);
+
+private:
+    struct ShardHandle {
+        explicit ShardHandle(TypeCounters &counters) : counters(counters), shard(counters.acquireShard()) {}
+
+        ShardHandle(const ShardHandle &) = delete;
+        ShardHandle &operator=(const ShardHandle &) = delete;
+
+        ~ShardHandle() {
+            counters.retireShard(shard);
+        }
+
+        TypeCounters &counters;
+        Shard &shard;
+    };
+
+    template<typename T>
+    static TypeCounters &getCounters() {
+        static TypeCounters &counters = registerType(typeid(T), sizeof(T));
+        return counters;
+    }
+
+    static TypeCounters &registerType(const std::type_info &type, std::size_t objectSize);
+};
+
+}// namespace eni
+
+#endif//ENI_MEMORY_OBJECT_ACCOUNTING_H
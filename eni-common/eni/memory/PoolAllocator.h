@@ -0,0 +1,299 @@
+//
+// Created by void on 10/18/26.
+//
+
+#ifndef ENI_MEMORY_POOL_ALLOCATOR_H
+#define ENI_MEMORY_POOL_ALLOCATOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace eni {
+
+namespace detail {
+
+/**
+ * A pool of blocks for objects of type T shared by all PoolAllocator instances of that type. Blocks are carved from
+ * large chunks and kept in a global free list, which is fed and drained in batches by the thread-local caches.
+ */
+template<typename T>
+class BlockPool {
+public:
+    static constexpr std::size_t Size = std::max(sizeof(T), sizeof(void *));
+    static constexpr std::size_t Align = std::max(alignof(T), alignof(void *));
+    static constexpr std::size_t Stride = (Size + Align - 1) / Align * Align;
+    static constexpr std::size_t BlocksPerChunk = std::max<std::size_t>(64, 16384 / Stride);
+    static constexpr std::size_t BatchSize = std::max<std::size_t>(8, BlocksPerChunk / 4);
+
+    struct Block {
+        Block *next;
+    };
+
+    /**
+     * A singly linked list of free blocks.
+     */
+    struct FreeList {
+        Block *head = nullptr;
+        std::size_t size = 0;
+
+        void push(void *ptr) {
+            auto *block = static_cast<Block *>(ptr);
+            block->next = head;
+            head = block;
+            size++;
+        }
+
+        Block *pop() {
+            auto *block = head;
+            head = block->next;
+            size--;
+            return block;
+        }
+    };
+
+    /**
+     * The cache of the current thread, which hands its blocks back to the pool when the thread exits.
+     */
+    struct ThreadCache {
+        BlockPool &pool = BlockPool::get();
+        FreeList blocks;
+
+        ThreadCache() = default;
+        ThreadCache(const ThreadCache &) = delete;
+        ThreadCache &operator=(const ThreadCache &) = delete;
+
+        ~ThreadCache() {
+            _threadCacheDestroyed = true;
+            pool.drain(blocks, blocks.size);
+        }
+    };
+
+public:
+    BlockPool() = default;
+    BlockPool(const BlockPool &) = delete;
+    BlockPool &operator=(const BlockPool &) = delete;
+
+    ~BlockPool() {
+        for (auto *chunk : _chunks) {
+            ::operator delete(chunk, std::align_val_t(Align));
+        }
+    }
+
+    static BlockPool &get() {
+        static BlockPool pool;
+        return pool;
+    }
+
+    /**
+     * @return The cache of the current thread, or nullptr once it has been destroyed at thread exit. Objects freed by
+     * static destructors or by later thread-local destructors are then handed back to the pool directly.
+     */
+    static ThreadCache *getThreadCache() {
+        if (_threadCacheDestroyed) {
+            return nullptr;
+        }
+        thread_local ThreadCache cache;
+        return &cache;
+    }
+
+    void *allocate() {
+        auto *cache = getThreadCache();
+        if (cache == nullptr) {
+            FreeList list;
+            fill(list, 1);
+            return list.pop();
+        }
+
+        if (cache->blocks.size == 0) {
+            fill(cache->blocks, BatchSize);
+        }
+        return cache->blocks.pop();
+    }
+
+    void deallocate(void *ptr) {
+        auto *cache = getThreadCache();
+        if (cache == nullptr) {
+            FreeList list;
+            list.push(ptr);
+            drain(list, 1);
+            return;
+        }
+
+        cache->blocks.push(ptr);
+        if (cache->blocks.size >= 2 * BatchSize) {
+            drain(cache->blocks, BatchSize);
+        }
+    }
+
+    /**
+     * Moves up to count free blocks into the given list, allocating new chunks as required.
+     */
+    void fill(FreeList &list, std::size_t count) {
+        auto lk = std::lock_guard(_mutex);
+        while (list.size < count) {
+            if (_free.size == 0) {
+                _allocateChunk();
+            }
+            list.push(_free.pop());
+        }
+    }
+
+    /**
+     * Moves count blocks from the given list back into the pool.
+     */
+    void drain(FreeList &list, std::size_t count) {
+        auto lk = std::lock_guard(_mutex);
+        for (std::size_t i = 0; i < count && list.size > 0; ++i) {
+            _free.push(list.pop());
+        }
+    }
+
+    /**
+     * Returns the blocks cached by the current thread to the pool and releases all chunks without live blocks.
+     * @return The number of bytes released.
+     */
+    std::size_t reclaim() {
+        if (auto *cache = getThreadCache()) {
+            drain(cache->blocks, cache->blocks.size);
+        }
+
+        auto lk = std::lock_guard(_mutex);
+        if (_chunks.empty()) {
+            return 0;
+        }
+
+        // _chunks is kept sorted, so each free block can be mapped to its chunk by a binary search.
+        std::vector<std::size_t> freeCounts(_chunks.size());
+        for (auto *block = _free.head; block != nullptr; block = block->next) {
+            freeCounts[_getChunkIndex(block)]++;
+        }
+
+        std::vector<std::byte *> unusedChunks;
+        std::vector<std::byte *> usedChunks;
+        for (std::size_t i = 0; i < _chunks.size(); ++i) {
+            (freeCounts[i] == BlocksPerChunk ? unusedChunks : usedChunks).push_back(_chunks[i]);
+        }
+
+        if (unusedChunks.empty()) {
+            return 0;
+        }
+
+        FreeList remaining;
+        while (_free.size > 0) {
+            auto *block = _free.pop();
+            if (freeCounts[_getChunkIndex(block)] != BlocksPerChunk) {
+                remaining.push(block);
+            }
+        }
+
+        for (auto *chunk : unusedChunks) {
+            ::operator delete(chunk, std::align_val_t(Align));
+        }
+
+        _free = remaining;
+        _chunks = std::move(usedChunks);
+        return unusedChunks.size() * BlocksPerChunk * Stride;
+    }
+
+    /**
+     * @return The number of bytes currently reserved by the pool.
+     */
+    std::size_t getReservedBytes() {
+        auto lk = std::lock_guard(_mutex);
+        return _chunks.size() * BlocksPerChunk * Stride;
+    }
+
+private:
+    void _allocateChunk() {
+        auto *chunk = static_cast<std::byte *>(::operator new(BlocksPerChunk * Stride, std::align_val_t(Align)));
+        _chunks.insert(std::ranges::upper_bound(_chunks, chunk), chunk);
+
+        // Push in reverse so blocks are handed out in address order.
+        for (std::size_t i = BlocksPerChunk; i > 0; --i) {
+            _free.push(chunk + (i - 1) * Stride);// NOLINT(*-pro-bounds-pointer-arithmetic)
+        }
+    }
+
+    std::size_t _getChunkIndex(const Block *block) const {
+        const auto *ptr = reinterpret_cast<const std::byte *>(block);
+        auto it = std::ranges::upper_bound(_chunks, ptr, std::less<>{});
+        return static_cast<std::size_t>(std::distance(_chunks.begin(), it)) - 1;
+    }
+
+private:
+    /// Trivially destructible, so that it can still be read after the cache of the thread has been destroyed.
+    static inline thread_local bool _threadCacheDestroyed = false;
+
+    std::mutex _mutex;
+    FreeList _free;
+    std::vector<std::byte *> _chunks;
+};
+
+}// namespace detail
+
+/**
+ * A stateless allocator that serves single-object allocations from a per-type pool with thread-local caches. Array
+ * allocations are forwarded to the global operator new.
+ *
+ * Pass it to ManagedObject to opt into pooled allocation:
+ *
+ *     class Particle : public ManagedObject<Particle, PoolAllocator<Particle>> { ... };
+ *
+ * @tparam T The type to allocate.
+ */
+template<typename T>
+class PoolAllocator {
+    using pool_type = detail::BlockPool<T>;
+
+public:
+    using value_type = T;
+
+    PoolAllocator() noexcept = default;
+
+    template<typename U>
+    PoolAllocator(const PoolAllocator<U> & /*other*/) noexcept {}// NOLINT(*-explicit-constructor)
+
+    [[nodiscard]] T *allocate(std::size_t n) {
+        if (n == 1) {
+            return static_cast<T *>(pool_type::get().allocate());
+        }
+        return static_cast<T *>(::operator new(n * sizeof(T), std::align_val_t(alignof(T))));
+    }
+
+    void deallocate(T *ptr, std::size_t n) noexcept {
+        if (n == 1) {
+            pool_type::get().deallocate(ptr);
+        } else {
+            ::operator delete(ptr, std::align_val_t(alignof(T)));
+        }
+    }
+
+    /**
+     * Returns the blocks cached by the current thread to the pool and releases all chunks that hold no live objects.
+     * @return The number of bytes released.
+     */
+    static std::size_t reclaim() {
+        return pool_type::get().reclaim();
+    }
+
+    /**
+     * @return The number of bytes currently reserved by the pool.
+     */
+    static std::size_t getReservedBytes() {
+        return pool_type::get().getReservedBytes();
+    }
+
+    template<typename U>
+    bool operator==(const PoolAllocator<U> & /*other*/) const noexcept {
+        return true;
+    }
+};
+
+}// namespace eni
+
+#endif//ENI_MEMORY_POOL_ALLOCATOR_H
@@ -0,0 +1,101 @@
+//
+// Created by void on 10/18/26.
+//
+
+#include <eni/memory/ReleaseQueue.h>
+
+#include <algorithm>
+#include <exception>
+
+namespace eni {
+
+ReleaseQueue::ReleaseQueue(std::size_t capacity) {
+    _pending.reserve(capacity);
+    _collecting.reserve(capacity);
+}
+
+ReleaseQueue::~ReleaseQueue() {
+    stopBackgroundCollection();
+
+    // Destructors may queue further objects, so keep going until the queue has been drained.
+    while (collect() > 0) {}
+}
+
+void ReleaseQueue::enqueue(void *ptr, deleter_type deleter) noexcept {
+    try {
+        auto lk = std::lock_guard(_mutex);
+        _pending.push_back({ptr, deleter});
+        _statistics.peakPending = std::max(_statistics.peakPending, _pending.size());
+        return;
+    } catch (const std::exception &) {
+        // Out of memory, fall through rather than leaking the object.
+    }
+    deleter(ptr);
+}
+
+std::size_t ReleaseQueue::collect() {
+    auto collectLk = std::lock_guard(_collectMutex);
+
+    {
+        auto lk = std::lock_guard(_mutex);
+        _collecting.swap(_pending);
+    }
+
+    const auto count = _collecting.size();
+    if (count == 0) {
+        return 0;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    for (const auto &entry : _collecting) {
+        entry.deleter(entry.ptr);
+    }
+    _collecting.clear();
+    const auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+    {
+        auto lk = std::lock_guard(_mutex);
+        _statistics.reclaimed += count;
+        _statistics.collections++;
+        _statistics.lastReclaimTime = duration;
+        _statistics.maxReclaimTime = std::max(_statistics.maxReclaimTime, duration);
+        _statistics.totalReclaimTime += duration;
+    }
+
+    return count;
+}
+
+void ReleaseQueue::startBackgroundCollection(std::chrono::milliseconds interval) {
+    stopBackgroundCollection();
+
+    _collector = std::jthread([this, interval](const std::stop_token &stopToken) {
+        auto lk = std::unique_lock(_wakeupMutex);
+        while (!_wakeup.wait_for(lk, stopToken, interval, [] { return false; })) {
+            if (stopToken.stop_requested()) {
+                break;
+            }
+            collect();
+        }
+    });
+}
+
+void ReleaseQueue::stopBackgroundCollection() {
+    if (_collector.joinable()) {
+        _collector.request_stop();
+        _collector.join();
+    }
+}
+
+std::size_t ReleaseQueue::size() const {
+    auto lk = std::lock_guard(_mutex);
+    return _pending.size();
+}
+
+ReleaseQueue::Statistics ReleaseQueue::getStatistics() const {
+    auto lk = std::lock_guard(_mutex);
+    auto statistics = _statistics;
+    statistics.pending = _pending.size();
+    return statistics;
+}
+
+}// namespace eni
@@ -0,0 +1,110 @@
+//
+// Created by void on 10/18/26.
+//
+
+#ifndef ENI_MEMORY_RELEASE_QUEUE_H
+#define ENI_MEMORY_RELEASE_QUEUE_H
+
+#include <eni/build_config.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace eni {
+
+/**
+ * A queue of pending object destructions that are run later in bulk, either at an explicit collection point by calling
+ * collect() or periodically on a background thread.
+ *
+ * ManagedObject types opt into deferred destruction with ManagedObject<T>::setReleaseQueue().
+ */
+class ReleaseQueue {
+public:
+    using deleter_type = void (*)(void *);
+
+    struct Statistics {
+        std::size_t pending = 0;               //< The number of destructions currently queued.
+        std::size_t peakPending = 0;           //< The highest number of destructions queued at once.
+        uint64 reclaimed = 0;                  //< The total number of objects destroyed by collections.
+        uint64 collections = 0;                //< The number of collections that destroyed at least one object.
+        std::chrono::nanoseconds lastReclaimTime{};//< The time the last of these collections took.
+        std::chrono::nanoseconds maxReclaimTime{}; //< The time the longest of these collections took.
+        std::chrono::nanoseconds totalReclaimTime{};
+    };
+
+    /// The number of destructions the queue has room for before it allocates.
+    static constexpr std::size_t DefaultCapacity = 1024;
+
+public:
+    /**
+     * @param capacity The number of destructions to reserve room for. The queue only allocates on enqueue() when more
+     * destructions are pending at once.
+     */
+    explicit ReleaseQueue(std::size_t capacity = DefaultCapacity);
+
+    ReleaseQueue(const ReleaseQueue &) = delete;
+    ReleaseQueue &operator=(const ReleaseQueue &) = delete;
+
+    /**
+     * Stops the background collection and destroys all objects still queued.
+     */
+    ~ReleaseQueue();
+
+    /**
+     * Queues the destruction of an object. If the queue cannot grow, the object is destroyed right away instead.
+     * @param ptr The object to destroy.
+     * @param deleter The function destroying the object.
+     */
+    void enqueue(void *ptr, deleter_type deleter) noexcept;
+
+    /**
+     * Destroys all queued objects on the calling thread.
+     * @return The number of destroyed objects.
+     */
+    std::size_t collect();
+
+    /**
+     * Starts collecting periodically on a background thread.
+     * @param interval The time between two collections.
+     */
+    void startBackgroundCollection(std::chrono::milliseconds interval);
+
+    /**
+     * Stops the background collection, if running. Queued objects remain queued.
+     */
+    void stopBackgroundCollection();
+
+    /**
+     * @return The number of destructions currently queued.
+     */
+    [[nodiscard]] std::size_t size() const;
+
+    /**
+     * @return The queue length and reclaim time metrics.
+     */
+    [[nodiscard]] Statistics getStatistics() const;
+
+private:
+    struct Entry {
+        void *ptr;
+        deleter_type deleter;
+    };
+
+    mutable std::mutex _mutex;
+    std::vector<Entry> _pending;
+    Statistics _statistics;
+
+    // Swapped with _pending by collect(), so both buffers keep their capacity.
+    std::mutex _collectMutex;
+    std::vector<Entry> _collecting;
+    std::mutex _wakeupMutex;
+    std::condition_variable_any _wakeup;
+    std::jthread _collector;
+};
+
+}// namespace eni
+
+#endif//ENI_MEMORY_RELEASE_QUEUE_H
@@ -5,200 +5,126 @@
 #include <algorithm>
 #include <eni/strings.h>
 
-#include <codecvt>
+#include <stdexcept>
+#include <string_view>
 
 namespace eni::strings {
 
 std::wstring toWide(const std::string &str) {
-    using convert_typeX = std::codecvt_utf8<wchar_t>;
-    std::wstring_convert<convert_typeX> converterX;
-
-    return converterX.from_bytes(str);
+    std::wstring result;
+    TranscodeResult transcoded;
+    result.resize_and_overwrite(str.size(), [&str, &transcoded](wchar_t *data, std::size_t size) {
+        transcoded = toWide(str, std::span(data, size));
+        return transcoded.written;
+    });
+
+    if (!transcoded) {
+        throw std::range_error(std::string("toWide: ") + to_string(transcoded.error) + " at byte " + std::to_string(transcoded.read));
+    }
+    return result;
 }
 
 std::string fromWide(const std::wstring &wideStr) {
-    using convert_typeX = std::codecvt_utf8<wchar_t>;
-    std::wstring_convert<convert_typeX> converterX;
+    std::string result;
+    TranscodeResult transcoded;
+    result.resize_and_overwrite(getUtf8Length(wideStr), [&wideStr, &transcoded](char *data, std::size_t size) {
+        transcoded = fromWide(wideStr, std::span(data, size));
+        return transcoded.written;
+    });
+
+    if (!transcoded) {
+        throw std::range_error(std::string("fromWide: ") + to_string(transcoded.error) + " at character " + std::to_string(transcoded.read));
+    }
+    return result;
+}
 
-    return converterX.to_bytes(wideStr);
+namespace detail {
+/**
+ * Shrinks a string to a view of it.
+ */
+template<typename CharT>
+void erase_outside(std::basic_string<CharT> &str, std::basic_string_view<CharT> view) {
+    const auto from = static_cast<std::size_t>(view.data() - str.data());
+    str.erase(from + view.size());
+    str.erase(0, from);
 }
+}// namespace detail
 
 void trim(std::string &str, const std::string &chars) {
-    auto from = str.find_first_not_of(chars);
-    auto to = str.find_last_not_of(chars);
-    if (to != std::string::npos) {
-        str.erase(to + 1, str.length() - 1);
-    }
-    if (from != std::string::npos) {
-        str.erase(0, from);
-    }
+    // The default set is classified 16 bytes at a time.
+    detail::erase_outside(str, chars == " \t\n\r" ? trimmed(str) : trimmed(str, chars));
 }
 
 void trim(std::wstring &str, const std::wstring &chars) {
-    auto from = str.find_first_not_of(chars);
-    auto to = str.find_last_not_of(chars);
-
-    if (from == std::wstring::npos && to == std::wstring::npos) {
-        str.clear();
-    }
+    detail::erase_outside(str, chars == L" \t\n\r" ? trimmed(str) : trimmed(str, chars));
+}
 
-    if (to != std::wstring::npos && to < str.length() - 1) {
-        str.erase(to + 1, str.length() - 1);
-    }
-    if (from != std::wstring::npos) {
-        str.erase(0, from);
+namespace detail {
+template<typename CharT>
+std::vector<std::basic_string<CharT>> tokenize(std::basic_string_view<CharT> str, const std::vector<std::basic_string<CharT>> &separators,
+                                               const bool trim, const bool skipEmpty, const bool keepSeparators) {
+    std::vector<std::basic_string<CharT>> r;
+    for (const auto token : basic_split_view<CharT, std::basic_string<CharT>>(str, separators, {trim, skipEmpty, keepSeparators})) {
+        r.emplace_back(token);
     }
+    return r;
 }
+}// namespace detail
 
 std::vector<std::string> tokenize(const std::string &str,
                                   const std::vector<std::string> &separators, const bool trim,
                                   const bool skipEmpty, const bool keepSeparators) {
-    std::vector<std::wstring> separatorsW;
-
-    separatorsW.reserve(separators.size());
-    for (const auto &separator : separators) {
-        separatorsW.push_back(toWide(separator));
-    }
-
-    auto wr = tokenize(toWide(str), separatorsW, trim, skipEmpty,
-                       keepSeparators);
-    std::vector<std::string> r;
-    r.reserve(wr.size());
-    for (auto &wstr : wr) {
-        r.push_back(fromWide(wstr));
-    }
-    return r;
+    return detail::tokenize(std::string_view(str), separators, trim, skipEmpty, keepSeparators);
 }
 
-std::vector<std::wstring> tokenize(const std::wstring &str,// NOLINT(*-function-cognitive-complexity)
+std::vector<std::wstring> tokenize(const std::wstring &str,
                                    const std::vector<std::wstring> &separators,
                                    const bool trim,
                                    const bool skipEmpty, const bool keepSeparators) {
-    // since find_first_of seeks for any char in the given string, we need to make
-    // substring checks here
-    std::wstring::size_type n = 0;
-    std::wstring::size_type offset = 0;
-    std::vector<std::wstring> r;
-
-    while (n < str.length()) {
-        bool found = false;
-        for (const auto &separator : separators) {
-            if (n + separator.length() >= str.length()) {
-                continue;
-            }
-            std::wstring sub = str.substr(n, separator.length());
-            if (sub == separator) {
-                found = true;
-                std::wstring token = str.substr(offset, n - offset);
-                if (trim) {
-                    strings::trim(token);
-                }
-                n += separator.length();
-                offset = n;
-                if (!skipEmpty || !token.empty()) {
-                    if (!token.empty() ||
-                        !r.empty()) {// Do not allow first token to be empty.
-                        r.push_back(token);
-                    }
-                }
-
-                if (keepSeparators) {
-                    r.push_back(sub);
-                }
-                break;
-            }
-        }
-        if (!found) {
-            ++n;
-        }
-    }
-
-    if (auto remaining = str.substr(offset); !remaining.empty()) {
-        if (trim) {
-            strings::trim(remaining);
-        }
-
-        r.push_back(remaining);
-    }
+    return detail::tokenize(std::wstring_view(str), separators, trim, skipEmpty, keepSeparators);
+}
 
-    return r;
+namespace detail {
+template<typename ConvertT>
+std::string convertCaseStyle(const std::string &str, ConvertT convert) {
+    // The converted string is never longer.
+    std::string result;
+    result.resize_and_overwrite(str.size(), [&str, &convert](char *data, std::size_t) {
+        return static_cast<std::size_t>(convert(str, data) - data);
+    });
+    return result;
 }
+}// namespace detail
 
 std::string toSnakeCase(const std::string &str) {
-    const auto tokens = tokenize(str, std::vector<std::string>({" ", "\t", "-", "_"}), true,
-                                 true, false);
-    auto s = implode<std::string>("_", tokens);
-    std::ranges::transform(s, s.begin(), ::tolower);
-    return s;
+    return detail::convertCaseStyle(str, [](std::string_view s, char *out) { return toSnakeCase(s, out); });
 }
 
 std::string toKebabCase(const std::string &str) {
-    const auto tokens = tokenize(str, std::vector<std::string>({" ", "\t", "-", "_"}), true,
-                                 true, false);
-    auto s = implode<std::string>("-", tokens);
-    std::ranges::transform(s, s.begin(), ::tolower);
-    return s;
+    return detail::convertCaseStyle(str, [](std::string_view s, char *out) { return toKebabCase(s, out); });
 }
 
 std::string toCamelCase(const std::string &str, const bool capitalizeFirstLetter) {
-    auto tokens = tokenize(str, std::vector<std::string>({" ", "\t", "-", "_"}), true,
-                           true, false);
-    std::stringstream ss;
-    bool first = true;
-    for (auto &t : tokens) {
-        if (!first || capitalizeFirstLetter) {
-            ss << std::toupper(t[0]);
-            ss << t.substr(1);
-        } else /*if (first)*/ {
-            first = false;
-            ss << t;
-        }
-    }
-    return ss.str();
+    return detail::convertCaseStyle(str, [capitalizeFirstLetter](std::string_view s, char *out) {
+        return toCamelCase(s, out, capitalizeFirstLetter);
+    });
 }
 
 std::string toUppercase(const std::string &str) {
-    auto result = str;
-    std::ranges::transform(result, result.begin(), ::toupper);
+    std::string result;
+    result.resize_and_overwrite(str.size(), [&str](char *data, std::size_t) {
+        toUppercase(str, std::span(data, str.size()));
+        return str.size();
+    });
     return result;
 }
 
 std::string toLowercase(const std::string &str) {
-    auto result = str;
-    std::ranges::transform(result, result.begin(), ::tolower);
-    return result;
-}
-
-std::string join(const std::string &separator, const std::vector<std::string> &components) {
     std::string result;
-    bool first = true;
-
-    for (const std::string &c : components) {
-        if (!first) {
-            result += separator;
-        } else {
-            first = false;
-        }
-
-        result += c;
-    }
-    return result;
-}
-
-std::wstring join(const std::wstring &separator,
-                  const std::vector<std::wstring> &components) {
-    std::wstring result;
-    bool first = true;
-
-    for (const std::wstring &c : components) {
-        if (!first) {
-            result += separator;
-        } else {
-            first = false;
-        }
-
-        result += c;
-    }
+    result.resize_and_overwrite(str.size(), [&str](char *data, std::size_t) {
+        toLowercase(str, std::span(data, str.size()));
+        return str.size();
+    });
     return result;
 }
 
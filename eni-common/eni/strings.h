@@ -5,6 +5,18 @@
 #ifndef ENI_STRINGS_H
 #define ENI_STRINGS_H
 
+#include <eni/strings/case.h>
+#include <eni/strings/case_style.h>
+#include <eni/strings/join.h>
+#include <eni/strings/parallel_split.h>
+#include <eni/strings/split_view.h>
+#include <eni/strings/string_arena.h>
+#include <eni/strings/symbol_table.h>
+#include <eni/strings/token_stream.h>
+#include <eni/strings/token_table.h>
+#include <eni/strings/trim.h>
+#include <eni/strings/utf8.h>
+
 #include <locale>
 #include <sstream>
 #include <string>
@@ -13,36 +25,42 @@
 namespace eni::strings {
 
 /**
- * Converts an ANSI string to UTF-8.
+ * Converts a UTF-8 string to a wide string.
  * @param str The string to convert.
  * @return The converted wide string.
+ * @throws std::range_error if the string is not valid UTF-8.
+ * @see toWide(std::span<const char>, std::span<wchar_t>) to convert into an existing buffer.
  */
 [[nodiscard]] std::wstring toWide(const std::string &str);
 
 /**
- * Converts a UTF-8 string to ANSI. Use carefully, this is not a lossless conversion and mostly used internally in situations where wide strings are not supported (yet).
+ * Converts a wide string to UTF-8. Mostly used internally in situations where wide strings are not supported (yet).
  *
  * @param str The wide string to convert.
  * @return The converted string.
+ * @throws std::range_error if the string contains surrogates or characters beyond U+10FFFF.
+ * @see fromWide(std::span<const wchar_t>, std::span<char>) to convert into an existing buffer.
  */
 [[nodiscard]] std::string fromWide(const std::wstring &str);
 
 /**
- * Trims a string by removing characters from its left and right.
+ * Trims a string by removing characters from its left and right. A string made only of such characters becomes empty.
  * @param str The string to trim.
  * @param chars The characters to remove.
+ * @see trimmed() to trim without modifying the string.
  */
 extern void trim(std::string &str, const std::string &chars = " \t\n\r");
 
 /**
- * Trims a string by removing characters from its left and right.
+ * Trims a string by removing characters from its left and right. A string made only of such characters becomes empty.
  * @param str The string to trim.
  * @param chars The characters to remove.
+ * @see trimmed() to trim without modifying the string.
  */
 extern void trim(std::wstring &str, const std::wstring &chars = L" \t\n\r");
 
 /**
- * Splits a string into tokens.
+ * Splits a UTF-8 string into tokens. The string is tokenized as is, without converting it to a wide string.
  * @param str The string to tokenize.
  * @param separators A list of separators.
  * @param trim Whether to trim the tokens.
@@ -102,58 +120,47 @@ tokenize(const std::wstring &str, const std::wstring &separator, bool trim = tru
 }
 
 /**
- * Joins a list of strings into a new string.
- * @param separator The separator to put between the string components.
- * @param components The components list.
- * @return The joined string.
- */
-extern std::string join(const std::string &separator,
-                        const std::vector<std::string> &components);
-
-/**
- * Joins a list of strings into a new string.
- * @param separator The separator to put between the string components.
- * @param components The components list.
- * @return The joined string.
- */
-extern std::wstring join(const std::wstring &separator,
-                         const std::vector<std::wstring> &components);
-
-/**
- * Converts a string to snake_case.
+ * Converts a string to snake_case. Words are separated by spaces, tabs, dashes and underscores, and trimmed. ASCII
+ * letters are converted to lower case.
  * @param str The string.
  * @return The converted string.
+ * @see toSnakeCase(std::string_view, OutputIt) to convert into a buffer.
  */
 extern std::string toSnakeCase(const std::string &str);
 
 /**
- * Converts a string to kebab-case.
+ * Converts a string to kebab-case, with the same rules as toSnakeCase().
  * @param str The string.
  * @return The converted string.
+ * @see toKebabCase(std::string_view, OutputIt) to convert into a buffer.
  */
 extern std::string toKebabCase(const std::string &str);
 
 /**
- * Converts a string to camelCase.
+ * Converts a string to camelCase. Words are split with the same rules as toSnakeCase(), the first letter of every
+ * word but the first is converted to upper case, the rest is kept as is.
  * @param str The string.
  * @param capitalizeFirstLetter Whether to begin the string with a capital
  * letter.
  * @return The converted string.
+ * @see toCamelCase(std::string_view, OutputIt, bool) to convert into a buffer.
  */
 extern std::string toCamelCase(const std::string &str,
                                bool capitalizeFirstLetter = false);
 
 /**
- * Converts a string to upper case.
+ * Converts a UTF-8 string to upper case.
  * @param str The string.
  * @return The converted string.
+ * @see toUppercaseInPlace() for how characters are converted.
  */
 extern std::string toUppercase(const std::string &str);
 
 /**
- * Converts a string to lower case.
+ * Converts a UTF-8 string to lower case.
  * @param str The string.
  * @return The converted string.
+ * @see toUppercaseInPlace() for how characters are converted.
  */
 extern std::string toLowercase(const std::string &str);
 
@@ -164,20 +171,13 @@ extern std::string toLowercase(const std::string &str);
  * @param separator The separator to put between the imploded elements.
  * @param container The container of elements.
  * @return The imploded string.
+ * @see joinInto() for how elements are converted.
  */
 template<typename T, typename ContainerT = std::vector<T>>
 std::string implode(const std::string &separator, const ContainerT &container) {
-    std::stringstream ss;
-    bool first = true;
-    for (auto &s : container) {
-        if (!first) {
-            ss << separator;
-        } else {
-            first = false;
-        }
-        ss << s;
-    }
-    return ss.str();
+    std::string result;
+    joinInto(result, separator, container);
+    return result;
 }
 
 /**
@@ -187,20 +187,13 @@ std::string implode(const std::string &separator, const ContainerT &container) {
  * @param separator The separator to put between the imploded elements.
  * @param container The container of elements.
  * @return The imploded string.
+ * @see joinInto() for how elements are converted.
  */
 template<typename T, typename ContainerT = std::vector<T>>
 std::wstring implode(const std::wstring &separator, const ContainerT &container) {
-    std::wstringstream ss;
-    bool first = true;
-    for (auto &s : container) {
-        if (!first) {
-            ss << separator;
-        } else {
-            first = false;
-        }
-        ss << s;
-    }
-    return ss.str();
+    std::wstring result;
+    joinInto(result, separator, container);
+    return result;
 }
 
 }// namespace eni::strings
@@ -0,0 +1,248 @@
+//
+// Created by void on 10/18/26.
+//
+
+#include <eni/strings/case.h>
+#include <eni/strings/utf8.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstring>
+#include <cwctype>
+#include <functional>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace eni::strings {
+
+namespace detail {
+enum class CaseConversion {
+    Upper,
+    Lower,
+    Fold,
+};
+
+/**
+ * Folds a code point to lower case with a fixed table, so that the result does not depend on the locale. Covers the
+ * Latin, Greek, Cyrillic and Armenian letters and the fullwidth Latin letters whose simple lower case mapping keeps the
+ * length of their UTF-8 encoding.
+ */
+constexpr char32_t foldCodePoint(char32_t c) {
+    // Ranges whose lower case letters are at a fixed offset from their upper case ones.
+    if ((c >= 0xC0 && c <= 0xDE && c != 0xD7) || (c >= 0x391 && c <= 0x3AB && c != 0x3A2) || (c >= 0x410 && c <= 0x42F) ||
+        (c >= 0xFF21 && c <= 0xFF3A)) {
+        return c + 0x20;
+    }
+    if (c >= 0x400 && c <= 0x40F) {
+        return c + 0x50;
+    }
+    if (c >= 0x531 && c <= 0x556) {
+        return c + 0x30;
+    }
+
+    // Ranges alternating between an upper case letter at an even and its lower case letter at an odd code point.
+    if ((c >= 0x100 && c <= 0x12F) || (c >= 0x132 && c <= 0x137) || (c >= 0x14A && c <= 0x177) || (c >= 0x460 && c <= 0x481) ||
+        (c >= 0x48A && c <= 0x4BF) || (c >= 0x4D0 && c <= 0x52F) || (c >= 0x1E00 && c <= 0x1E95) || (c >= 0x1EA0 && c <= 0x1EFF)) {
+        return c | 1;
+    }
+    // The same, with the upper case letters at odd code points.
+    if ((c >= 0x139 && c <= 0x148) || (c >= 0x179 && c <= 0x17E) || (c >= 0x4C1 && c <= 0x4CE)) {
+        return (c & 1) != 0 ? c + 1 : c;
+    }
+
+    switch (c) {
+        case 0x178: return 0xFF;
+        case 0x386: return 0x3AC;
+        case 0x388:
+        case 0x389:
+        case 0x38A: return c + 0x25;
+        case 0x38C: return 0x3CC;
+        case 0x38E:
+        case 0x38F: return c + 0x3F;
+        case 0x3C2: return 0x3C3;
+        case 0x4C0: return 0x4CF;
+        default: return c;
+    }
+}
+
+template<CaseConversion Conversion>
+inline char convertAscii(char c) {
+    constexpr bool Upper = Conversion == CaseConversion::Upper;
+    constexpr char first = Upper ? 'a' : 'A';
+    return c >= first && c <= first + 25 ? static_cast<char>(c ^ 0x20) : c;
+}
+
+#if defined(__SSE2__)
+template<CaseConversion Conversion>
+inline __m128i convertAscii(__m128i block) {
+    constexpr bool Upper = Conversion == CaseConversion::Upper;
+    // Bytes above 0x7F are negative, so they never fall in the range.
+    const auto before = _mm_set1_epi8(Upper ? 'a' - 1 : 'A' - 1);
+    const auto after = _mm_set1_epi8(Upper ? 'z' + 1 : 'Z' + 1);
+    const auto inRange = _mm_and_si128(_mm_cmpgt_epi8(block, before), _mm_cmpgt_epi8(after, block));
+    return _mm_xor_si128(block, _mm_and_si128(inRange, _mm_set1_epi8(0x20)));
+}
+#endif
+
+/**
+ * Converts the non-ASCII code point at in[i], which may alias out[i].
+ * @return The position after the code point.
+ */
+template<CaseConversion Conversion>
+std::size_t convertCodePoint(std::string_view in, char *out, std::size_t i) {
+    auto next = i;
+    char32_t codePoint = 0;
+    if (decodeCodePoint(in, next, codePoint) != UtfError::None) {
+        out[i] = in[i];
+        return i + 1;
+    }
+
+    char32_t converted = codePoint;
+    if constexpr (Conversion == CaseConversion::Upper) {
+        converted = static_cast<char32_t>(std::towupper(static_cast<std::wint_t>(codePoint)));
+    } else if constexpr (Conversion == CaseConversion::Lower) {
+        converted = static_cast<char32_t>(std::towlower(static_cast<std::wint_t>(codePoint)));
+    } else {
+        converted = foldCodePoint(codePoint);
+    }
+    std::array<char, 4> encoded{};
+    if (converted != codePoint && encodeCodePoint(converted, encoded) == next - i) {
+        std::ranges::copy_n(encoded.begin(), static_cast<std::ptrdiff_t>(next - i), out + i);
+    } else {
+        std::copy(in.begin() + static_cast<std::ptrdiff_t>(i), in.begin() + static_cast<std::ptrdiff_t>(next), out + i);
+    }
+    return next;
+}
+
+template<CaseConversion Conversion>
+void convert(std::string_view in, char *out) {
+    const auto size = in.size();
+    std::size_t i = 0;
+
+#if defined(__SSE2__)
+    while (i + 16 <= size) {
+        const auto block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in.data() + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), convertAscii<Conversion>(block));
+
+        const auto mask = static_cast<uint32>(_mm_movemask_epi8(block));
+        if (mask == 0) {
+            i += 16;
+            continue;
+        }
+
+        // The ASCII bytes of the block are converted, converting them again is harmless. Resume after the first
+        // non-ASCII code point.
+        i = convertCodePoint<Conversion>(in, out, i + static_cast<std::size_t>(std::countr_zero(mask)));
+    }
+#endif
+
+    while (i < size) {
+        if (static_cast<unsigned char>(in[i]) < 0x80) {
+            out[i] = convertAscii<Conversion>(in[i]);
+            i++;
+        } else {
+            i = convertCodePoint<Conversion>(in, out, i);
+        }
+    }
+}
+
+/**
+ * Folds a string to lower case one chunk at a time. Chunks end on code point boundaries, so strings that are equal
+ * once folded are split at the same positions.
+ */
+class FoldedChunks {
+public:
+    static constexpr std::size_t ChunkSize = 256;
+
+    explicit FoldedChunks(std::string_view str) : _str(str) {}
+
+    /**
+     * @return The next chunk, empty at the end of the string.
+     */
+    std::string_view next() {
+        if (_position >= _str.size()) {
+            return {};
+        }
+
+        auto end = _str.size();
+        if (_position + ChunkSize < end) {
+            end = floorCodePointBoundary(_str, _position + ChunkSize);
+        }
+
+        const auto chunk = _str.substr(_position, end - _position);
+        convert<CaseConversion::Fold>(chunk, _buffer.data());
+        _position = end;
+        return {_buffer.data(), chunk.size()};
+    }
+
+private:
+    std::string_view _str;
+    std::size_t _position = 0;
+    std::array<char, ChunkSize> _buffer{};
+};
+}// namespace detail
+
+void toUppercaseInPlace(std::span<char> str) {
+    detail::convert<detail::CaseConversion::Upper>({str.data(), str.size()}, str.data());
+}
+
+void toLowercaseInPlace(std::span<char> str) {
+    detail::convert<detail::CaseConversion::Lower>({str.data(), str.size()}, str.data());
+}
+
+void toUppercase(std::string_view str, std::span<char> out) {
+    assert(out.size() >= str.size());
+    detail::convert<detail::CaseConversion::Upper>(str, out.data());
+}
+
+void toLowercase(std::string_view str, std::span<char> out) {
+    assert(out.size() >= str.size());
+    detail::convert<detail::CaseConversion::Lower>(str, out.data());
+}
+
+int compareIgnoreCase(std::string_view a, std::string_view b) {
+    detail::FoldedChunks chunksA(a);
+    detail::FoldedChunks chunksB(b);
+    std::string_view chunkA;
+    std::string_view chunkB;
+
+    while (true) {
+        if (chunkA.empty()) {
+            chunkA = chunksA.next();
+        }
+        if (chunkB.empty()) {
+            chunkB = chunksB.next();
+        }
+        if (chunkA.empty() || chunkB.empty()) {
+            return static_cast<int>(!chunkA.empty()) - static_cast<int>(!chunkB.empty());
+        }
+
+        const auto n = std::min(chunkA.size(), chunkB.size());
+        if (const auto result = std::memcmp(chunkA.data(), chunkB.data(), n); result != 0) {
+            return result < 0 ? -1 : 1;
+        }
+        chunkA.remove_prefix(n);
+        chunkB.remove_prefix(n);
+    }
+}
+
+bool equalsIgnoreCase(std::string_view a, std::string_view b) {
+    // Folding never changes the length.
+    return a.size() == b.size() && compareIgnoreCase(a, b) == 0;
+}
+
+std::size_t hashIgnoreCase(std::string_view str) {
+    detail::FoldedChunks chunks(str);
+    std::size_t seed = str.size();
+    for (auto chunk = chunks.next(); !chunk.empty(); chunk = chunks.next()) {
+        const auto value = std::hash<std::string_view>{}(chunk);
+        seed ^= value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+    }
+    return seed;
+}
+
+}// namespace eni::strings
@@ -0,0 +1,97 @@
+//
+// Created by void on 10/18/26.
+//
+
+#ifndef ENI_STRINGS_CASE_H
+#define ENI_STRINGS_CASE_H
+
+#include <eni/build_config.h>
+
+#include <cstddef>
+#include <span>
+#include <string_view>
+
+namespace eni::strings {
+
+/**
+ * Converts a UTF-8 string to upper case in place.
+ *
+ * ASCII is converted 16 bytes at a time without consulting the locale. Other characters are converted with
+ * std::towupper, but only when their upper case takes as many bytes, so the length of the string never changes.
+ * Invalid sequences are left as they are.
+ *
+ * @param str The string.
+ */
+void toUppercaseInPlace(std::span<char> str);
+
+/**
+ * Converts a UTF-8 string to lower case in place, with the same rules as toUppercaseInPlace().
+ * @param str The string.
+ */
+void toLowercaseInPlace(std::span<char> str);
+
+/**
+ * Converts a UTF-8 string to upper case into a buffer, with the same rules as toUppercaseInPlace().
+ * @param str The string.
+ * @param out The buffer to write to, must hold at least str.size() bytes.
+ */
+void toUppercase(std::string_view str, std::span<char> out);
+
+/**
+ * Converts a UTF-8 string to lower case into a buffer, with the same rules as toUppercaseInPlace().
+ * @param str The string.
+ * @param out The buffer to write to, must hold at least str.size() bytes.
+ */
+void toLowercase(std::string_view str, std::span<char> out);
+
+/**
+ * Compares two UTF-8 strings byte by byte, as if both were folded to lower case first.
+ *
+ * Unlike toLowercase(), folding does not consult the locale: ASCII and the Latin, Greek, Cyrillic and Armenian letters
+ * are folded with a fixed table, other characters are compared as they are. Comparisons, equality and hashes therefore
+ * stay the same when the locale changes, as containers keyed with them require.
+ *
+ * @return A negative value if a comes first, 0 if the strings are equal and a positive value if b comes first.
+ */
+int compareIgnoreCase(std::string_view a, std::string_view b);
+
+/**
+ * @return Whether two UTF-8 strings are equal once folded to lower case, see compareIgnoreCase().
+ */
+bool equalsIgnoreCase(std::string_view a, std::string_view b);
+
+/**
+ * @return A hash of a UTF-8 string folded to lower case, equal for strings that are equalsIgnoreCase().
+ */
+std::size_t hashIgnoreCase(std::string_view str);
+
+/**
+ * A transparent hash for case-insensitive unordered containers of strings.
+ */
+struct CaseInsensitiveHash {
+    using is_transparent = void;
+
+    std::size_t operator()(std::string_view str) const { return hashIgnoreCase(str); }
+};
+
+/**
+ * A transparent equality for case-insensitive unordered containers of strings.
+ */
+struct CaseInsensitiveEqual {
+    using is_transparent = void;
+
+    bool operator()(std::string_view a, std::string_view b) const { return equalsIgnoreCase(a, b); }
+};
+
+/**
+ * A transparent ordering for case-insensitive ordered containers of strings.
+ */
+struct CaseInsensitiveLess {
+    using is_transparent = void;
+
+    bool operator()(std::string_view a, std::string_view b) const { return compareIgnoreCase(a, b) < 0; }
+};
+
+}// namespace eni::strings
+
+#endif//ENI_STRINGS_CASE_H
@@ -0,0 +1,117 @@
+//
+// Created by void on 10/18/26.
+//
+
+#ifndef ENI_STRINGS_CASE_STYLE_H
+#define ENI_STRINGS_CASE_STYLE_H
+
+#include <eni/strings/split_view.h>
+
+#include <algorithm>
+#include <iterator>
+#include <string_view>
+
+namespace eni::strings {
+
+namespace detail {
+constexpr bool is_word_separator(char c) {
+    return c == ' ' || c == '\t' || c == '-' || c == '_';
+}
+
+constexpr char ascii_lower(char c) {
+    return c >= 'A' && c <= 'Z' ? static_cast<char>(c | 0x20) : c;
+}
+
+constexpr char ascii_upper(char c) {
+    return c >= 'a' && c <= 'z' ? static_cast<char>(c & ~0x20) : c;
+}
+
+/**
+ * Calls a function with every word of an identifier, the same tokens tokenize() finds with the separators " ", "\t",
+ * "-" and "_". All separators are single characters, so they are matched directly instead of through a
+ * basic_separator_search.
+ */
+template<typename FunctionT>
+constexpr void for_each_word(std::string_view str, FunctionT &&f) {
+    std::size_t offset = 0;
+    // As with tokenize(), a separator must be followed by at least one more character.
+    for (std::size_t i = 0; i + 1 < str.size(); ++i) {
+        if (is_word_separator(str[i])) {
+            if (const auto word = trimmed(str.substr(offset, i - offset)); !word.empty()) {
+                f(word);
+            }
+            offset = i + 1;
+        }
+    }
+    if (const auto word = trimmed(str.substr(offset)); !word.empty()) {
+        f(word);
+    }
+}
+
+template<std::output_iterator<char> OutputIt>
+OutputIt join_lowercase(std::string_view str, char separator, OutputIt out) {
+    bool first = true;
+    for_each_word(str, [&](std::string_view word) {
+        if (!first) {
+            *out++ = separator;
+        }
+        first = false;
+        out = std::ranges::transform(word, out, ascii_lower).out;
+    });
+    return out;
+}
+}// namespace detail
+
+/**
+ * Converts a string to snake_case in a single pass, without allocating.
+ *
+ * Words are split with the same rules as toSnakeCase(const std::string &). Only ASCII letters are converted. The
+ * result is never longer than the string, so a buffer of str.size() characters is always sufficient.
+ *
+ * @param str The string.
+ * @param out Where to write the converted string.
+ * @return The iterator past the last written character.
+ */
+template<std::output_iterator<char> OutputIt>
+OutputIt toSnakeCase(std::string_view str, OutputIt out) {
+    return detail::join_lowercase(str, '_', out);
+}
+
+/**
+ * Converts a string to kebab-case in a single pass, without allocating.
+ * @param str The string.
+ * @param out Where to write the converted string, str.size() characters are always sufficient.
+ * @return The iterator past the last written character.
+ * @see toSnakeCase(std::string_view, OutputIt)
+ */
+template<std::output_iterator<char> OutputIt>
+OutputIt toKebabCase(std::string_view str, OutputIt out) {
+    return detail::join_lowercase(str, '-', out);
+}
+
+/**
+ * Converts a string to camelCase in a single pass, without allocating.
+ * @param str The string.
+ * @param out Where to write the converted string, str.size() characters are always sufficient.
+ * @param capitalizeFirstLetter Whether to begin the string with a capital letter.
+ * @return The iterator past the last written character.
+ * @see toSnakeCase(std::string_view, OutputIt)
+ */
+template<std::output_iterator<char> OutputIt>
+OutputIt toCamelCase(std::string_view str, OutputIt out, bool capitalizeFirstLetter = false) {
+    bool first = true;
+    detail::for_each_word(str, [&](std::string_view word) {
+        if (!first || capitalizeFirstLetter) {
+            *out++ = detail::ascii_upper(word.front());
+            out = std::ranges::copy(word.substr(1), out).out;
+        } else {
+            out = std::ranges::copy(word, out).out;
+        }
+        first = false;
+    });
+    return out;
+}
+
+}// namespace eni::strings
+
+#endif//ENI_STRINGS_CASE_STYLE_H
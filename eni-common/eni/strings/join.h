@@ -0,0 +1,156 @@
+//
+// Created by void on 10/18/26.
+//
+
+#ifndef ENI_STRINGS_JOIN_H
+#define ENI_STRINGS_JOIN_H
+
+#include <eni/build_config.h>
+
+#include <fmt/format.h>
+
+#include <array>
+#include <charconv>
+#include <concepts>
+#include <iterator>
+#include <ranges>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace eni::strings {
+
+namespace detail {
+template<typename T, typename CharT>
+concept string_like = std::convertible_to<const T &, std::basic_string_view<CharT>>;
+
+/// Streams print signed and unsigned chars as characters, fmt and std::to_chars as numbers.
+template<typename T>
+concept byte_character = std::same_as<T, signed char> || std::same_as<T, unsigned char>;
+
+template<typename T>
+concept to_chars_convertible = std::is_arithmetic_v<T> && !std::same_as<T, bool> && !std::same_as<T, char> &&
+                               !std::same_as<T, wchar_t> && !std::same_as<T, char8_t> && !std::same_as<T, char16_t> &&
+                               !std::same_as<T, char32_t> && !byte_character<T>;
+
+/**
+ * @return The exact length of an element once appended, or 0 if it is only known by formatting it.
+ */
+template<typename CharT, typename T>
+std::size_t get_joined_length(const T &value) {
+    if constexpr (string_like<T, CharT>) {
+        return std::basic_string_view<CharT>(value).length();
+    } else if constexpr (std::same_as<T, CharT> || std::same_as<T, bool>) {
+        return 1;
+    } else {
+        return 0;
+    }
+}
+
+template<typename CharT, typename T>
+void append_joined(std::basic_string<CharT> &out, const T &value) {
+    if constexpr (string_like<T, CharT>) {
+        out.append(std::basic_string_view<CharT>(value));
+    } else if constexpr (std::same_as<T, CharT>) {
+        out.push_back(value);
+    } else if constexpr (std::same_as<T, bool>) {
+        // As streamed.
+        out.push_back(value ? CharT('1') : CharT('0'));
+    } else if constexpr (to_chars_convertible<T>) {
+        std::array<char, 128> buffer;// NOLINT(*-member-init)
+        std::to_chars_result result;
+        if constexpr (std::is_floating_point_v<T>) {
+            // As streamed with the default precision, which is printf's %g.
+            result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value, std::chars_format::general, 6);
+        } else {
+            result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+        }
+        if constexpr (std::same_as<CharT, char>) {
+            out.append(buffer.data(), static_cast<std::size_t>(result.ptr - buffer.data()));
+        } else {
+            out.append(buffer.data(), result.ptr);
+        }
+    } else if constexpr (std::same_as<CharT, char> && !byte_character<T> && fmt::is_formattable<T, CharT>::value) {
+        fmt::format_to(std::back_inserter(out), "{}", value);
+    } else {
+        std::basic_ostringstream<CharT> ss;
+        ss << value;
+        out.append(std::move(ss).str());
+    }
+}
+}// namespace detail
+
+/**
+ * Appends the elements of a range to a string, with a separator between them.
+ *
+ * Strings and string views are appended as is, numbers are formatted with std::to_chars, other elements with fmt if
+ * they can be, or streamed otherwise. Every element is formatted as if streamed: floating point numbers with a
+ * precision of 6 significant digits, and signed and unsigned chars as characters. For forward ranges, the string is reserved up front with the length of all the
+ * separators and string-like elements, so joining strings allocates at most once.
+ *
+ * @param out The string to append to.
+ * @param separator The separator to put between the elements.
+ * @param range The range of elements.
+ * @return out.
+ */
+template<typename CharT, std::ranges::input_range RangeT>
+std::basic_string<CharT> &joinInto(std::basic_string<CharT> &out, std::type_identity_t<std::basic_string_view<CharT>> separator,
+                                   RangeT &&range) {
+    // Elements are used as their value type, so proxies such as those of std::vector<bool> are not formatted.
+    using value_type = std::ranges::range_value_t<RangeT>;
+
+    if constexpr (std::ranges::forward_range<RangeT>) {
+        std::size_t length = 0;
+        std::size_t count = 0;
+        for (const value_type &element : range) {
+            length += detail::get_joined_length<CharT>(element);
+            count++;
+        }
+        if (count > 0) {
+            out.reserve(out.size() + length + (count - 1) * separator.length());
+        }
+    }
+
+    bool first = true;
+    for (const value_type &element : range) {
+        if (!first) {
+            out.append(separator);
+        }
+        first = false;
+        detail::append_joined(out, element);
+    }
+    return out;
+}
+
+/**
+ * Joins the elements of a range into a new string.
+ * @param separator The separator to put between the elements.
+ * @param range The range of elements.
+ * @return The joined string.
+ * @see joinInto() for how elements are converted.
+ */
+template<std::ranges::input_range RangeT>
+std::string join(std::string_view separator, RangeT &&range) {
+    std::string result;
+    joinInto(result, separator, std::forward<RangeT>(range));
+    return result;
+}
+
+/**
+ * Joins the elements of a range into a new wide string.
+ * @param separator The separator to put between the elements.
+ * @param range The range of elements.
+ * @return The joined string.
+ * @see joinInto() for how elements are converted.
+ */
+template<std::ranges::input_range RangeT>
+std::wstring join(std::wstring_view separator, RangeT &&range) {
+    std::wstring result;
+    joinInto(result, separator, std::forward<RangeT>(range));
+    return result;
+}
+
+}// namespace eni::strings
+
+#endif//ENI_STRINGS_JOIN_H
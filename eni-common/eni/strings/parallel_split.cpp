@@ -0,0 +1,152 @@
+//
+// Created by void on 10/18/26.
+//
+
+#include <eni/strings/parallel_split.h>
+
+#include <algorithm>
+#include <thread>
+
+namespace eni::strings {
+
+namespace detail {
+/// The minimum number of bytes worth handing to a thread.
+constexpr std::size_t MinPartitionSize = 64 * 1024;
+
+struct SeparatorMatch {
+    std::size_t position = 0;
+    std::size_t length = 0;
+};
+
+struct Partition {
+    std::size_t begin = 0;
+    std::size_t end = 0;
+    std::vector<SeparatorMatch> matches;//< The separators taken in the partition.
+    std::size_t entry = 0;              //< The end of the last separator taken before the partition.
+    std::vector<std::string_view> tokens;
+    std::size_t offset = 0;//< The position of the tokens in the result.
+};
+
+/**
+ * Runs f(i) for i in [0, count), each on its own thread.
+ */
+template<typename FunctionT>
+void parallel_for(std::size_t count, const FunctionT &f) {
+    std::vector<std::jthread> threads;
+    threads.reserve(count - 1);
+    for (std::size_t i = 1; i < count; ++i) {
+        threads.emplace_back(f, i);
+    }
+    f(0);
+}
+
+/**
+ * Takes the separators of a partition like tokenize() does, from a position on.
+ *
+ * When separators have been taken before from an earlier position, the search stops at the first separator taken both
+ * times, since everything after it is taken the same way.
+ */
+void take_matches(std::string_view str, std::span<const std::string> separators,
+                  const basic_separator_search<char, std::string> &search, Partition &partition, std::size_t from) {
+    const auto previous = std::move(partition.matches);
+    partition.matches.clear();
+
+    auto next = previous.begin();
+    for (auto position = from;;) {
+        const auto match = search.find(str, position, separators);
+        if (match.position >= partition.end) {
+            break;
+        }
+
+        while (next != previous.end() && next->position < match.position) {
+            ++next;
+        }
+        if (next != previous.end() && next->position == match.position) {
+            partition.matches.insert(partition.matches.end(), next, previous.end());
+            break;
+        }
+
+        partition.matches.push_back({match.position, match.length});
+        position = match.position + match.length;
+    }
+}
+}// namespace detail
+
+std::vector<std::string_view> splitParallel(std::string_view str, std::span<const std::string> separators,
+                                            TokenizeOptions options, std::size_t threadCount) {
+    if (threadCount == 0) {
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    const auto partitionCount = std::min(threadCount, str.size() / detail::MinPartitionSize);
+    if (partitionCount < 2) {
+        std::vector<std::string_view> tokens;
+        std::ranges::copy(basic_split_view<char, std::string>(str, separators, options), std::back_inserter(tokens));
+        return tokens;
+    }
+
+    const basic_separator_search<char, std::string> search(separators);
+    std::vector<detail::Partition> partitions(partitionCount);
+    for (std::size_t i = 0; i < partitionCount; ++i) {
+        partitions[i].begin = str.size() * i / partitionCount;
+        partitions[i].end = str.size() * (i + 1) / partitionCount;
+    }
+
+    // Take separators as if none taken in a previous partition reached into the partition.
+    detail::parallel_for(partitionCount, [&](std::size_t i) {
+        detail::take_matches(str, separators, search, partitions[i], partitions[i].begin);
+    });
+
+    // Fix up the partitions a separator taken in a previous partition reaches into.
+    std::size_t entry = 0;
+    for (auto &partition : partitions) {
+        partition.entry = entry;
+        if (entry > partition.begin) {
+            detail::take_matches(str, separators, search, partition, entry);
+        }
+        if (!partition.matches.empty()) {
+            entry = partition.matches.back().position + partition.matches.back().length;
+        }
+    }
+
+    // Cut the tokens that end in each partition.
+    detail::parallel_for(partitionCount, [&](std::size_t i) {
+        auto &partition = partitions[i];
+        auto tokenStart = partition.entry;
+        partition.tokens.reserve(partition.matches.size() * (options.keepSeparators ? 2 : 1));
+        for (const auto &match : partition.matches) {
+            auto token = str.substr(tokenStart, match.position - tokenStart);
+            if (options.trim) {
+                token = trimmed(token);
+            }
+            if (!options.skipEmpty || !token.empty()) {
+                partition.tokens.push_back(token);
+            }
+            if (options.keepSeparators) {
+                partition.tokens.push_back(str.substr(match.position, match.length));
+            }
+            tokenStart = match.position + match.length;
+        }
+    });
+
+    std::size_t size = 0;
+    for (auto &partition : partitions) {
+        partition.offset = size;
+        size += partition.tokens.size();
+    }
+
+    std::vector<std::string_view> tokens(size);
+    detail::parallel_for(partitionCount, [&](std::size_t i) {
+        std::ranges::copy(partitions[i].tokens, tokens.begin() + static_cast<std::ptrdiff_t>(partitions[i].offset));
+    });
+
+    // As with tokenize(), empty tokens are dropped until something has been kept. Separators are never empty.
+    tokens.erase(tokens.begin(), std::ranges::find_if(tokens, [](std::string_view token) { return !token.empty(); }));
+
+    if (const auto remaining = str.substr(entry); !remaining.empty()) {
+        tokens.push_back(options.trim ? trimmed(remaining) : remaining);
+    }
+    return tokens;
+}
+
+}// namespace eni::strings
@@ -0,0 +1,38 @@
+//
+// Created by void on 10/18/26.
+//
+
+#ifndef ENI_STRINGS_PARALLEL_SPLIT_H
+#define ENI_STRINGS_PARALLEL_SPLIT_H
+
+#include <eni/strings/split_view.h>
+
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace eni::strings {
+
+/**
+ * Splits a string into tokens on several threads, with the same results as tokenize().
+ *
+ * The string is partitioned across the threads, which take separators from the start of their partition on. A
+ * separator taken at the end of one partition may reach into the next and hide the separators it starts with, so
+ * partitions are then fixed up in order, searching again only until the same separators are taken. The tokens are
+ * then cut and collected in parallel again.
+ *
+ * Strings shorter than a few partitions are split on the calling thread.
+ *
+ * @param str The string to tokenize, the tokens point into it.
+ * @param separators A list of separators.
+ * @param options How to tokenize.
+ * @param threadCount The number of threads to use, 0 for std::thread::hardware_concurrency().
+ * @return The tokens, in order.
+ */
+std::vector<std::string_view> splitParallel(std::string_view str, std::span<const std::string> separators,
+                                            TokenizeOptions options = {}, std::size_t threadCount = 0);
+
+}// namespace eni::strings
+
+#endif//ENI_STRINGS_PARALLEL_SPLIT_H
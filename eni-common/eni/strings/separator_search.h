@@ -0,0 +1,321 @@
+//
+// Created by void on 10/18/26.
+//
+
+#ifndef ENI_STRINGS_SEPARATOR_SEARCH_H
+#define ENI_STRINGS_SEPARATOR_SEARCH_H
+
+#include <eni/build_config.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <limits>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace eni::strings {
+
+/**
+ * Finds the next occurrence of any of a list of separators, with the semantics of tokenize(): the match starting
+ * first wins, ties are won by the separator listed first, and a separator must be followed by at least one more
+ * character to match. Empty separators never match.
+ *
+ * The strategy depends on the separators:
+ *   - With few distinct first units, candidate positions are found 16 bytes at a time with SSE2 compares.
+ *   - Otherwise candidates are found through a lookup table of first units.
+ *   - With more than AutomatonThreshold separators, an Aho-Corasick automaton finds all of them in a single pass.
+ *
+ * The search does not store the separators, they are passed to every call and must be the ones it was built from.
+ * Only the automaton allocates.
+ *
+ * @tparam CharT The character type.
+ * @tparam SeparatorT The type of the separators, a std::basic_string or std::basic_string_view of CharT.
+ */
+template<typename CharT, typename SeparatorT = std::basic_string_view<CharT>>
+class basic_separator_search {
+public:
+    using string_view_type = std::basic_string_view<CharT>;
+    using unit_type = std::make_unsigned_t<CharT>;
+
+    static constexpr std::size_t npos = string_view_type::npos;
+
+    /// The number of separators above which an Aho-Corasick automaton is used.
+    static constexpr std::size_t AutomatonThreshold = 8;
+
+    /// The maximum number of distinct first units filtered with SIMD compares.
+    static constexpr std::size_t MaxSimdUnits = 4;
+
+    struct match {
+        std::size_t position = npos;//< The position of the separator in the string or npos.
+        std::size_t separator = 0;  //< The index of the separator.
+        std::size_t length = 0;     //< The length of the separator.
+    };
+
+    basic_separator_search() = default;
+
+    explicit basic_separator_search(std::span<const SeparatorT> separators) {
+        std::size_t count = 0;
+        for (const string_view_type separator : separators) {
+            if (separator.empty()) {
+                continue;
+            }
+            count++;
+
+            const auto first = static_cast<unit_type>(separator.front());
+            if (first < _firstUnits.size()) {
+                _firstUnits[first] = true;
+            } else {
+                _hasWideFirstUnit = true;
+            }
+
+            // Once there are too many distinct first units, _simdUnitCount stays at MaxSimdUnits + 1 and SIMD is off.
+            if (_simdUnitCount <= MaxSimdUnits) {
+                const auto simdUnits = std::span(_simdUnits).first(_simdUnitCount);
+                if (std::ranges::find(simdUnits, first) == simdUnits.end()) {
+                    if (_simdUnitCount < MaxSimdUnits) {
+                        _simdUnits[_simdUnitCount] = first;
+                    }
+                    _simdUnitCount++;
+                }
+            }
+        }
+
+        if (count > AutomatonThreshold) {
+            _automaton = std::make_shared<const Automaton>(separators);
+        }
+    }
+
+    /**
+     * Finds the next separator.
+     * @param str The string to search.
+     * @param from The position to start searching at.
+     * @param separators The separators the search has been built from.
+     * @return The match, with position npos if there is none.
+     */
+    [[nodiscard]] match find(string_view_type str, std::size_t from, std::span<const SeparatorT> separators) const {
+        if (_automaton) {
+            return _automaton->find(str, from, separators);
+        }
+
+        for (auto position = _findCandidate(str, from); position < str.size(); position = _findCandidate(str, position + 1)) {
+            for (std::size_t i = 0; i < separators.size(); ++i) {
+                const string_view_type separator = separators[i];
+                if (!separator.empty() && position + separator.length() < str.length() && str.compare(position, separator.length(), separator) == 0) {
+                    return {position, i, separator.length()};
+                }
+            }
+        }
+        return {};
+    }
+
+private:
+    [[nodiscard]] bool _isFirstUnit(CharT c) const {
+        const auto unit = static_cast<unit_type>(c);
+        return unit < _firstUnits.size() ? _firstUnits[unit] : _hasWideFirstUnit;
+    }
+
+    [[nodiscard]] std::size_t _findCandidate(string_view_type str, std::size_t from) const {
+        auto position = from;
+
+#if defined(__SSE2__)
+        if constexpr (sizeof(CharT) == 1 || sizeof(CharT) == 4) {
+            if (_simdUnitCount > 0 && _simdUnitCount <= MaxSimdUnits) {
+                constexpr std::size_t lanes = 16 / sizeof(CharT);
+
+                __m128i units[MaxSimdUnits];
+                for (std::size_t i = 0; i < _simdUnitCount; ++i) {
+                    if constexpr (sizeof(CharT) == 1) {
+                        units[i] = _mm_set1_epi8(static_cast<char>(_simdUnits[i]));
+                    } else {
+                        units[i] = _mm_set1_epi32(static_cast<int>(_simdUnits[i]));
+                    }
+                }
+
+                for (; position + lanes <= str.size(); position += lanes) {
+                    const auto block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(str.data() + position));
+
+                    auto hits = _mm_setzero_si128();
+                    for (std::size_t i = 0; i < _simdUnitCount; ++i) {
+                        if constexpr (sizeof(CharT) == 1) {
+                            hits = _mm_or_si128(hits, _mm_cmpeq_epi8(block, units[i]));
+                        } else {
+                            hits = _mm_or_si128(hits, _mm_cmpeq_epi32(block, units[i]));
+                        }
+                    }
+
+                    if (const auto mask = static_cast<uint32>(_mm_movemask_epi8(hits)); mask != 0) {
+                        return position + static_cast<std::size_t>(std::countr_zero(mask)) / sizeof(CharT);
+                    }
+                }
+            }
+        }
+#endif
+
+        for (; position < str.size(); ++position) {
+            if (_isFirstUnit(str[position])) {
+                return position;
+            }
+        }
+        return npos;
+    }
+
+private:
+    /**
+     * An Aho-Corasick automaton over the separators. Units are mapped to classes of the units occurring in any
+     * separator, all other units share class 0, so the transition table stays small for wide characters.
+     */
+    class Automaton {
+    public:
+        explicit Automaton(std::span<const SeparatorT> separators) {
+            for (const string_view_type separator : separators) {
+                for (const auto c : separator) {
+                    _addClass(static_cast<unit_type>(c));
+                }
+            }
+            std::ranges::sort(_wideClasses);
+
+            _transitions.assign(_classCount, 0);
+            std::vector<std::vector<uint32>> outputs(1);
+
+            // Build the trie.
+            for (std::size_t i = 0; i < separators.size(); ++i) {
+                const string_view_type separator = separators[i];
+                if (separator.empty()) {
+                    continue;
+                }
+
+                int32 state = 0;
+                for (const auto c : separator) {
+                    auto &next = _transitions[static_cast<std::size_t>(state) * _classCount + _getClass(c)];
+                    if (next == 0) {
+                        next = static_cast<int32>(outputs.size());
+                        outputs.emplace_back();
+                        _transitions.resize(_transitions.size() + _classCount, 0);
+                    }
+                    state = _transitions[static_cast<std::size_t>(state) * _classCount + _getClass(c)];
+                }
+                outputs[state].push_back(static_cast<uint32>(i));
+                _maxLength = std::max(_maxLength, separator.length());
+            }
+
+            // Turn the trie into the automaton, breadth-first.
+            std::vector<int32> fail(outputs.size(), 0);
+            std::vector<int32> queue;
+            for (std::size_t k = 0; k < _classCount; ++k) {
+                if (const auto next = _transitions[k]; next != 0) {
+                    queue.push_back(next);
+                }
+            }
+
+            for (std::size_t head = 0; head < queue.size(); ++head) {
+                const auto state = queue[head];
+                auto &stateOutputs = outputs[state];
+                const auto &failOutputs = outputs[fail[state]];
+                stateOutputs.insert(stateOutputs.end(), failOutputs.begin(), failOutputs.end());
+
+                for (std::size_t k = 0; k < _classCount; ++k) {
+                    auto &next = _transitions[static_cast<std::size_t>(state) * _classCount + k];
+                    const auto fallback = _transitions[static_cast<std::size_t>(fail[state]) * _classCount + k];
+                    if (next != 0) {
+                        fail[next] = fallback;
+                        queue.push_back(next);
+                    } else {
+                        next = fallback;
+                    }
+                }
+            }
+
+            _outputOffsets.reserve(outputs.size() + 1);
+            for (auto &stateOutputs : outputs) {
+                _outputOffsets.push_back(static_cast<uint32>(_outputs.size()));
+                _outputs.insert(_outputs.end(), stateOutputs.begin(), stateOutputs.end());
+            }
+            _outputOffsets.push_back(static_cast<uint32>(_outputs.size()));
+        }
+
+        [[nodiscard]] match find(string_view_type str, std::size_t from, std::span<const SeparatorT> separators) const {
+            match best;
+            int32 state = 0;
+
+            for (auto i = from; i < str.size(); ++i) {
+                // No later match can start before the best one.
+                if (best.position != npos && i >= best.position + _maxLength) {
+                    break;
+                }
+
+                state = _transitions[static_cast<std::size_t>(state) * _classCount + _getClass(str[i])];
+                // A separator must be followed by at least one more character.
+                if (i + 1 >= str.size()) {
+                    break;
+                }
+
+                for (auto o = _outputOffsets[state]; o < _outputOffsets[state + 1]; ++o) {
+                    const auto separator = _outputs[o];
+                    const auto length = string_view_type(separators[separator]).length();
+                    const auto position = i + 1 - length;
+                    if (position < best.position || (position == best.position && separator < best.separator)) {
+                        best = {position, separator, length};
+                    }
+                }
+            }
+
+            return best;
+        }
+
+    private:
+        void _addClass(unit_type unit) {
+            if (unit < _asciiClasses.size()) {
+                if (_asciiClasses[unit] == 0) {
+                    _asciiClasses[unit] = static_cast<uint32>(_classCount++);
+                }
+            } else if (std::ranges::find(_wideClasses, unit, &std::pair<unit_type, uint32>::first) == _wideClasses.end()) {
+                _wideClasses.emplace_back(unit, static_cast<uint32>(_classCount++));
+            }
+        }
+
+        [[nodiscard]] std::size_t _getClass(CharT c) const {
+            const auto unit = static_cast<unit_type>(c);
+            if (unit < _asciiClasses.size()) {
+                return _asciiClasses[unit];
+            }
+            if constexpr (sizeof(CharT) > 1) {
+                const auto it = std::ranges::lower_bound(_wideClasses, unit, {}, &std::pair<unit_type, uint32>::first);
+                if (it != _wideClasses.end() && it->first == unit) {
+                    return it->second;
+                }
+            }
+            return 0;
+        }
+
+    private:
+        std::array<uint32, 256> _asciiClasses{};
+        std::vector<std::pair<unit_type, uint32>> _wideClasses;
+        std::size_t _classCount = 1;
+
+        std::vector<int32> _transitions;
+        std::vector<uint32> _outputOffsets;
+        std::vector<uint32> _outputs;
+        std::size_t _maxLength = 0;
+    };
+
+private:
+    std::array<bool, 256> _firstUnits{};
+    bool _hasWideFirstUnit = false;
+
+    std::array<unit_type, MaxSimdUnits> _simdUnits{};
+    std::size_t _simdUnitCount = 0;
+
+    std::shared_ptr<const Automaton> _automaton;
+};
+
+}// namespace eni::strings
+
+#endif//ENI_STRINGS_SEPARATOR_SEARCH_H
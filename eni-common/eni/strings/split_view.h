@@ -0,0 +1,214 @@
+//
+// Created by void on 10/18/26.
+//
+
+#ifndef ENI_STRINGS_SPLIT_VIEW_H
+#define ENI_STRINGS_SPLIT_VIEW_H
+
+#include <eni/strings/separator_search.h>
+#include <eni/strings/trim.h>
+
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace eni::strings {
+
+/**
+ * Options of tokenize() and split_view().
+ */
+struct TokenizeOptions {
+    bool trim = true;           //< Whether to trim the tokens.
+    bool skipEmpty = true;      //< Whether to skip empty tokens.
+    bool keepSeparators = false;//< Whether to keep the separators as tokens.
+};
+
+/**
+ * A lazy range of the tokens of a string, with the same semantics as tokenize().
+ *
+ * Tokens are std::basic_string_views into the string and are only found when the range is iterated. Separators are
+ * found with a basic_separator_search, so nothing is allocated unless there are enough separators to build an
+ * automaton. The range refers to the string and the separators, which must outlive it.
+ *
+ * @tparam CharT The character type.
+ * @tparam SeparatorT The type of the separators, a std::basic_string or std::basic_string_view of CharT.
+ */
+template<typename CharT, typename SeparatorT = std::basic_string_view<CharT>>
+class basic_split_view : public std::ranges::view_interface<basic_split_view<CharT, SeparatorT>> {
+public:
+    using string_view_type = std::basic_string_view<CharT>;
+
+    class iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = string_view_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const string_view_type *;
+        using reference = const string_view_type &;
+
+        iterator() = default;
+
+        reference operator*() const { return _current; }
+        pointer operator->() const { return &_current; }
+
+        iterator &operator++() {
+            _advance();
+            return *this;
+        }
+
+        iterator operator++(int) {
+            auto it = *this;
+            _advance();
+            return it;
+        }
+
+        bool operator==(const iterator &other) const {
+            return _done == other._done && (_done || (_position == other._position && _pending == other._pending && _current.data() == other._current.data()));
+        }
+
+        bool operator==(std::default_sentinel_t) const { return _done; }
+
+    private:
+        friend class basic_split_view;
+
+        explicit iterator(const basic_split_view *parent) : _parent(parent), _done(false) { _advance(); }
+
+        void _advance() {
+            if (_hasPending) {
+                _hasPending = false;
+                _emit(_pending);
+                return;
+            }
+
+            const auto str = _parent->_str;
+            const auto separators = _parent->_getSeparators();
+            while (_position < str.length()) {
+                const auto match = _parent->_search.find(str, _position, separators);
+                if (match.position == string_view_type::npos) {
+                    _position = str.length();
+                    break;
+                }
+
+                auto token = str.substr(_offset, match.position - _offset);
+                if (_parent->_options.trim) {
+                    token = trimmed(token);
+                }
+                _position = match.position + match.length;
+                _offset = _position;
+
+                if (_parent->_options.keepSeparators) {
+                    _pending = str.substr(match.position, match.length);
+                    _hasPending = true;
+                }
+
+                // Do not allow the first token to be empty.
+                if ((!_parent->_options.skipEmpty || !token.empty()) && (!token.empty() || _emitted)) {
+                    _emit(token);
+                    return;
+                }
+                if (_hasPending) {
+                    _hasPending = false;
+                    _emit(_pending);
+                    return;
+                }
+            }
+
+            if (!_finished) {
+                _finished = true;
+                if (auto remaining = str.substr(_offset); !remaining.empty()) {
+                    _emit(_parent->_options.trim ? trimmed(remaining) : remaining);
+                    return;
+                }
+            }
+
+            _done = true;
+        }
+
+        void _emit(string_view_type token) {
+            _current = token;
+            _emitted = true;
+        }
+
+    private:
+        const basic_split_view *_parent = nullptr;
+        std::size_t _position = 0;
+        std::size_t _offset = 0;
+        string_view_type _current;
+        string_view_type _pending;
+        bool _hasPending = false;
+        bool _emitted = false;
+        bool _finished = false;
+        bool _done = true;
+    };
+
+    basic_split_view(string_view_type str, std::span<const SeparatorT> separators, TokenizeOptions options = {})
+        : _str(str), _separators(separators), _options(options), _search(_getSeparators()) {}
+
+    basic_split_view(string_view_type str, string_view_type separator, TokenizeOptions options = {})
+        requires std::same_as<SeparatorT, string_view_type>
+        : _str(str), _singleSeparator(separator), _options(options), _search(_getSeparators()) {}
+
+    [[nodiscard]] iterator begin() const { return iterator(this); }
+
+    [[nodiscard]] std::default_sentinel_t end() const { return {}; }
+
+    /**
+     * @return The string being split.
+     */
+    [[nodiscard]] string_view_type base() const { return _str; }
+
+private:
+    [[nodiscard]] std::span<const SeparatorT> _getSeparators() const {
+        if constexpr (std::same_as<SeparatorT, string_view_type>) {
+            if (_separators.empty()) {
+                return {&_singleSeparator, 1};
+            }
+        }
+        return _separators;
+    }
+
+private:
+    string_view_type _str;
+    std::span<const SeparatorT> _separators;
+    string_view_type _singleSeparator;
+    TokenizeOptions _options;
+    basic_separator_search<CharT, SeparatorT> _search;
+};
+
+/**
+ * Splits a string lazily into tokens.
+ * @param str The string to tokenize, must outlive the range.
+ * @param separators A list of separators, must outlive the range.
+ * @param options How to tokenize.
+ * @return A range of std::string_view tokens.
+ */
+inline auto split_view(std::string_view str, std::span<const std::string> separators, TokenizeOptions options = {}) {
+    return basic_split_view<char, std::string>(str, separators, options);
+}
+
+inline auto split_view(std::string_view str, std::span<const std::string_view> separators, TokenizeOptions options = {}) {
+    return basic_split_view<char>(str, separators, options);
+}
+
+inline auto split_view(std::string_view str, std::string_view separator, TokenizeOptions options = {}) {
+    return basic_split_view<char>(str, separator, options);
+}
+
+inline auto split_view(std::wstring_view str, std::span<const std::wstring> separators, TokenizeOptions options = {}) {
+    return basic_split_view<wchar_t, std::wstring>(str, separators, options);
+}
+
+inline auto split_view(std::wstring_view str, std::span<const std::wstring_view> separators, TokenizeOptions options = {}) {
+    return basic_split_view<wchar_t>(str, separators, options);
+}
+
+inline auto split_view(std::wstring_view str, std::wstring_view separator, TokenizeOptions options = {}) {
+    return basic_split_view<wchar_t>(str, separator, options);
+}
+
+}// namespace eni::strings
+
+#endif//ENI_STRINGS_SPLIT_VIEW_H
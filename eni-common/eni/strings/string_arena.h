@@ -0,0 +1,81 @@
+//
+// Created by void on 10/18/26.
+//
+
+#ifndef ENI_STRINGS_STRING_ARENA_H
+#define ENI_STRINGS_STRING_ARENA_H
+
+#include <eni/build_config.h>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace eni::strings {
+
+/**
+ * Append-only storage for the strings of an interning table. Strings are copied into large blocks and never moved or
+ * removed, so the views returned by store() stay valid for the lifetime of the arena.
+ *
+ * store() must be synchronized by the owner, getBytes() may be called concurrently.
+ *
+ * @tparam CharT The character type.
+ */
+template<typename CharT>
+class basic_string_arena {
+public:
+    using string_view_type = std::basic_string_view<CharT>;
+
+    /// The number of characters of the blocks the strings are copied to.
+    static constexpr std::size_t BlockSize = 16 * 1024;
+
+    basic_string_arena() = default;
+    basic_string_arena(const basic_string_arena &) = delete;
+    basic_string_arena &operator=(const basic_string_arena &) = delete;
+
+    /**
+     * Copies a string into the arena.
+     * @param str The string.
+     * @return The view of the copy.
+     */
+    string_view_type store(string_view_type str) {
+        // Long strings get a block of their own, so they do not waste the rest of the current block.
+        if (str.size() > BlockSize / 4) {
+            auto &block = _blocks.emplace_back(std::make_unique<CharT[]>(str.size()));
+            _bytes.fetch_add(str.size() * sizeof(CharT), std::memory_order_relaxed);
+            std::ranges::copy(str, block.get());
+            return {block.get(), str.size()};
+        }
+
+        if (_blockUsed + str.size() > BlockSize) {
+            _blocks.push_back(std::make_unique<CharT[]>(BlockSize));
+            _bytes.fetch_add(BlockSize * sizeof(CharT), std::memory_order_relaxed);
+            _blockUsed = 0;
+            _currentBlock = _blocks.back().get();
+        }
+
+        auto *data = _currentBlock + _blockUsed;
+        std::ranges::copy(str, data);
+        _blockUsed += str.size();
+        return {data, str.size()};
+    }
+
+    /**
+     * @return The memory held by the blocks.
+     */
+    [[nodiscard]] std::size_t getBytes() const {
+        return _bytes.load(std::memory_order_relaxed);
+    }
+
+private:
+    std::vector<std::unique_ptr<CharT[]>> _blocks;
+    CharT *_currentBlock = nullptr;
+    std::size_t _blockUsed = BlockSize;
+    std::atomic<std::size_t> _bytes = 0;
+};
+
+}// namespace eni::strings
+
+#endif//ENI_STRINGS_STRING_ARENA_H
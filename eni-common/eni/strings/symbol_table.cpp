@@ -0,0 +1,144 @@
+//
+// Created by void on 10/18/26.
+//
+
+#include <eni/strings/symbol_table.h>
+
+#include <bit>
+#include <cassert>
+#include <limits>
+#include <stdexcept>
+
+namespace eni::strings {
+
+SymbolTable::Index::Index(std::size_t capacity)
+    : mask(capacity - 1), slots(std::make_unique<std::atomic<const detail::SymbolEntry *>[]>(capacity)) {}
+
+SymbolTable::SymbolTable() {
+    _indices.push_back(std::make_unique<Index>(FirstSegmentSize));
+    _index.store(_indices.back().get(), std::memory_order_release);
+}
+
+SymbolTable::~SymbolTable() {
+    for (std::size_t k = 0; k < MaxSegments; ++k) {
+        delete[] _segments[k].load(std::memory_order_relaxed);
+    }
+}
+
+SymbolTable &SymbolTable::global() {
+    static SymbolTable table;
+    return table;
+}
+
+Symbol SymbolTable::intern(std::string_view str) {
+    if (str.empty()) {
+        return {};
+    }
+
+    const auto hash = std::hash<std::string_view>{}(str);
+    if (const auto *entry = _find(str, hash)) {
+        return Symbol(entry);
+    }
+
+    auto lk = std::lock_guard(_mutex);
+    if (const auto *entry = _find(str, hash)) {
+        return Symbol(entry);
+    }
+
+    const auto size = _size.load(std::memory_order_relaxed);
+    if (size > std::numeric_limits<SymbolId>::max() || str.size() > std::numeric_limits<uint32>::max()) {
+        throw std::length_error("SymbolTable: too many symbols or symbol too long");
+    }
+
+    auto &entry = _allocateEntry(static_cast<SymbolId>(size));
+    entry.hash = hash;
+    entry.data = _arena.store(str).data();
+    entry.length = static_cast<uint32>(str.size());
+    entry.id = static_cast<SymbolId>(size);
+
+    // Keep the load factor at most 1/2. The new index is filled before it is published, readers of the old one keep
+    // using it until they are done.
+    const auto *index = _index.load(std::memory_order_relaxed);
+    if (2 * size > index->mask + 1) {
+        auto &grown = _indices.emplace_back(std::make_unique<Index>(2 * (index->mask + 1)));
+        for (std::size_t i = 0; i <= index->mask; ++i) {
+            if (const auto *existing = index->slots[i].load(std::memory_order_relaxed)) {
+                _insert(*grown, existing);
+            }
+        }
+        _insert(*grown, &entry);
+        _index.store(grown.get(), std::memory_order_release);
+    } else {
+        _insert(*_indices.back(), &entry);
+    }
+
+    _size.store(size + 1, std::memory_order_release);
+    return Symbol(&entry);
+}
+
+std::optional<Symbol> SymbolTable::find(std::string_view str) const {
+    if (str.empty()) {
+        return Symbol();
+    }
+    if (const auto *entry = _find(str, std::hash<std::string_view>{}(str))) {
+        return Symbol(entry);
+    }
+    return std::nullopt;
+}
+
+Symbol SymbolTable::get(SymbolId id) const {
+    if (id == 0) {
+        return {};
+    }
+    assert(id < _size.load(std::memory_order_acquire));
+    const auto [segment, offset] = _locate(id);
+    return Symbol(&_segments[segment].load(std::memory_order_acquire)[offset]);
+}
+
+std::size_t SymbolTable::size() const {
+    return _size.load(std::memory_order_acquire);
+}
+
+std::size_t SymbolTable::getBytes() const {
+    return _arena.getBytes();
+}
+
+const detail::SymbolEntry *SymbolTable::_find(std::string_view str, std::size_t hash) const {
+    const auto *index = _index.load(std::memory_order_acquire);
+    for (auto i = hash & index->mask;; i = (i + 1) & index->mask) {
+        const auto *entry = index->slots[i].load(std::memory_order_acquire);
+        if (entry == nullptr) {
+            return nullptr;
+        }
+        if (entry->hash == hash && std::string_view(entry->data, entry->length) == str) {
+            return entry;
+        }
+    }
+}
+
+void SymbolTable::_insert(Index &index, const detail::SymbolEntry *entry) {
+    auto i = entry->hash & index.mask;
+    while (index.slots[i].load(std::memory_order_relaxed) != nullptr) {
+        i = (i + 1) & index.mask;
+    }
+    index.slots[i].store(entry, std::memory_order_release);
+}
+
+detail::SymbolEntry &SymbolTable::_allocateEntry(SymbolId id) {
+    const auto [segment, offset] = _locate(id);
+    auto *entries = _segments[segment].load(std::memory_order_relaxed);
+    if (entries == nullptr) {
+        entries = new detail::SymbolEntry[FirstSegmentSize << segment];
+        _segments[segment].store(entries, std::memory_order_release);
+    }
+    return entries[offset];
+}
+
+std::pair<std::size_t, std::size_t> SymbolTable::_locate(SymbolId id) {
+    // Segment k holds the ids from (2^k - 1) * FirstSegmentSize on.
+    const auto block = static_cast<std::size_t>(id) / FirstSegmentSize + 1;
+    const auto segment = static_cast<std::size_t>(std::bit_width(block)) - 1;
+    return {segment, static_cast<std::size_t>(id) - ((std::size_t{1} << segment) - 1) * FirstSegmentSize};
+}
+
+}// namespace eni::strings
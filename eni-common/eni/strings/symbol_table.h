@@ -0,0 +1,170 @@
+//
+// Created by void on 10/18/26.
+//
+
+#ifndef ENI_STRINGS_SYMBOL_TABLE_H
+#define ENI_STRINGS_SYMBOL_TABLE_H
+
+#include <eni/build_config.h>
+#include <eni/strings/string_arena.h>
+
+#include <array>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace eni::strings {
+
+/**
+ * The id of a symbol in a SymbolTable.
+ */
+using SymbolId = uint32;
+
+namespace detail {
+struct SymbolEntry {
+    std::size_t hash = 0;
+    const char *data = "";
+    uint32 length = 0;
+    SymbolId id = 0;
+};
+
+/// The entry of the empty string, shared by every table so that default-constructed symbols are empty.
+inline constexpr SymbolEntry empty_symbol_entry{};
+}// namespace detail
+
+/**
+ * An interned string.
+ *
+ * A symbol is a pointer to the single copy of a string in its SymbolTable, so symbols of the same table compare and
+ * hash as integers, and the string is available without going through the table. A default-constructed symbol is the
+ * empty string, whose id is 0 in every table.
+ */
+class Symbol {
+public:
+    Symbol() = default;
+
+    /**
+     * @return The id of the symbol in its table.
+     */
+    [[nodiscard]] SymbolId id() const { return _entry->id; }
+
+    /**
+     * @return The string, valid for the lifetime of the table.
+     */
+    [[nodiscard]] std::string_view view() const { return {_entry->data, _entry->length}; }
+
+    [[nodiscard]] bool empty() const { return _entry->length == 0; }
+
+    [[nodiscard]] bool operator==(const Symbol &other) const = default;
+
+private:
+    friend class SymbolTable;
+
+    explicit Symbol(const detail::SymbolEntry *entry) : _entry(entry) {}
+
+private:
+    const detail::SymbolEntry *_entry = &detail::empty_symbol_entry;
+};
+
+/**
+ * A thread-safe table of interned strings.
+ *
+ * Every distinct string is copied once into arena blocks and gets a small, stable id. Looking up a string that is
+ * already interned, or a symbol by id, is lock-free: the hash index is an open-addressing table of atomic pointers
+ * that is replaced, never modified in a way readers could observe half-done, when it grows. Only interning a new string
+ * takes a lock.
+ *
+ * Strings are never removed, so symbols and their views stay valid for the lifetime of the table.
+ */
+class SymbolTable {
+public:
+    SymbolTable();
+    ~SymbolTable();
+
+    SymbolTable(const SymbolTable &) = delete;
+    SymbolTable &operator=(const SymbolTable &) = delete;
+
+    /**
+     * @return The process-wide table.
+     */
+    static SymbolTable &global();
+
+    /**
+     * Interns a string.
+     * @param str The string.
+     * @return The symbol of the string, equal strings have equal symbols.
+     */
+    Symbol intern(std::string_view str);
+
+    /**
+     * Looks up a string without interning it. Lock-free.
+     * @param str The string.
+     * @return The symbol of the string, if it has been interned.
+     */
+    [[nodiscard]] std::optional<Symbol> find(std::string_view str) const;
+
+    /**
+     * Looks up a symbol by id. Lock-free.
+     * @param id The id of an interned string.
+     * @return The symbol.
+     */
+    [[nodiscard]] Symbol get(SymbolId id) const;
+
+    /**
+     * @return The number of distinct strings, including the empty string.
+     */
+    [[nodiscard]] std::size_t size() const;
+
+    /**
+     * @return The memory held by the string data.
+     */
+    [[nodiscard]] std::size_t getBytes() const;
+
+private:
+    /// The number of entries of the first segment, every further segment is twice as large as the previous one.
+    static constexpr std::size_t FirstSegmentSize = 1024;
+
+    /// Enough segments for every SymbolId.
+    static constexpr std::size_t MaxSegments = 23;
+
+    struct Index {
+        explicit Index(std::size_t capacity);
+
+        std::size_t mask;
+        std::unique_ptr<std::atomic<const detail::SymbolEntry *>[]> slots;
+    };
+
+    [[nodiscard]] const detail::SymbolEntry *_find(std::string_view str, std::size_t hash) const;
+
+    void _insert(Index &index, const detail::SymbolEntry *entry);
+
+    detail::SymbolEntry &_allocateEntry(SymbolId id);
+
+    static std::pair<std::size_t, std::size_t> _locate(SymbolId id);
+
+private:
+    std::mutex _mutex;
+
+    std::atomic<const Index *> _index;
+    std::vector<std::unique_ptr<Index>> _indices;
+
+    std::array<std::atomic<detail::SymbolEntry *>, MaxSegments> _segments{};
+    std::atomic<std::size_t> _size = 1;
+
+    basic_string_arena<char> _arena;
+};
+
+}// namespace eni::strings
+
+template<>
+struct std::hash<eni::strings::Symbol> {
+    std::size_t operator()(const eni::strings::Symbol &symbol) const noexcept {
+        return std::hash<eni::strings::SymbolId>{}(symbol.id());
+    }
+};
+
+#endif//ENI_STRINGS_SYMBOL_TABLE_H
@@ -0,0 +1,60 @@
+//
+// Created by void on 10/18/26.
+//
+
+#include <eni/exception.h>
+#include <eni/strings/token_stream.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+
+namespace eni::strings::detail {
+
+MappedFile::MappedFile(const std::filesystem::path &path) {
+    const auto fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        throw IOException("Failed to open " + path.string() + ": " + std::strerror(errno));
+    }
+
+    struct stat st {};
+    if (fstat(fd, &st) != 0) {
+        ::close(fd);
+        throw IOException("Failed to stat " + path.string() + ": " + std::strerror(errno));
+    }
+
+    _size = static_cast<std::size_t>(st.st_size);
+    if (_size == 0) {
+        ::close(fd);
+        return;
+    }
+
+    _mapping = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (_mapping == MAP_FAILED) {
+        _mapping = nullptr;
+        throw IOException("Failed to map " + path.string() + ": " + std::strerror(errno));
+    }
+    madvise(_mapping, _size, MADV_SEQUENTIAL);
+}
+
+MappedFile::~MappedFile() {
+    if (_mapping) {
+        munmap(_mapping, _size);
+    }
+}
+
+void MappedFile::release(std::size_t offset) {
+    const auto pageSize = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    const auto end = std::min(offset, _size) / pageSize * pageSize;
+    if (_mapping && end > _released) {
+        madvise(static_cast<char *>(_mapping) + _released, end - _released, MADV_DONTNEED);
+        _released = end;
+    }
+}
+
+}// namespace eni::strings::detail
@@ -0,0 +1,262 @@
+//
+// Created by void on 10/18/26.
+//
+
+#ifndef ENI_STRINGS_TOKEN_STREAM_H
+#define ENI_STRINGS_TOKEN_STREAM_H
+
+#include <eni/strings/separator_search.h>
+#include <eni/strings/split_view.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <istream>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace eni::strings {
+
+namespace detail {
+/**
+ * A read-only memory mapping of a whole file.
+ */
+class MappedFile {
+public:
+    /**
+     * @throws IOException if the file cannot be mapped.
+     */
+    explicit MappedFile(const std::filesystem::path &path);
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    ~MappedFile();
+
+    [[nodiscard]] std::string_view view() const { return {static_cast<const char *>(_mapping), _size}; }
+
+    /**
+     * Tells the kernel the pages before an offset are no longer needed, so they do not stay resident.
+     */
+    void release(std::size_t offset);
+
+private:
+    void *_mapping = nullptr;
+    std::size_t _size = 0;
+    std::size_t _released = 0;
+};
+}// namespace detail
+
+/**
+ * Tokenizes a string that arrives in chunks, with the same semantics as tokenize().
+ *
+ * Tokens are passed to a callback as std::string_views, valid until the callback returns. Tokens that lie within a
+ * chunk are not copied; only the token that spans the end of a chunk is kept in an internal buffer, so memory is
+ * bounded by the longest token rather than the input.
+ *
+ * A separator match is only accepted once enough input follows it to rule out an earlier or preferred separator
+ * continuing into the next chunk, and once at least one more character follows it, as tokenize() requires.
+ */
+class TokenStream {
+public:
+    /// The size of the chunks read from streams and memory-mapped files.
+    static constexpr std::size_t ChunkSize = 1024 * 1024;
+
+    explicit TokenStream(std::vector<std::string> separators, TokenizeOptions options = {})
+        : _separators(std::move(separators)), _options(options), _search(std::span<const std::string>(_separators)) {
+        for (const auto &separator : _separators) {
+            _maxLength = std::max(_maxLength, separator.length());
+        }
+    }
+
+    /**
+     * Tokenizes the next chunk of the input.
+     * @param chunk The chunk, only needs to be valid during the call.
+     * @param f The callback, called with every token that is complete.
+     */
+    template<typename FunctionT>
+    void feed(std::string_view chunk, FunctionT &&f) {
+        if (_carry.empty()) {
+            _keep(chunk, _process(chunk, 0, 0, false, f));
+            return;
+        }
+
+        // Small chunks cannot tell whether a separator starts at the end of the carry, append them.
+        if (chunk.size() <= _maxLength) {
+            _appendToCarry(chunk, f);
+            return;
+        }
+
+        // A separator may start in the undecided end of the carry and continue into the chunk.
+        const auto tail = std::string_view(_carry).substr(_scanFrom);
+        _joint.assign(tail);
+        _joint.append(chunk.substr(0, _maxLength + 1));
+        if (const auto match = _search.find(_joint, 0, _getSeparators()); match.position < tail.size()) {
+            // The separator ends within the carry, so does the next token start.
+            if (match.position + match.length < tail.size()) {
+                _appendToCarry(chunk, f);
+                return;
+            }
+
+            _carry.resize(_scanFrom + match.position);
+            _emitToken(_carry, f);
+            _emitSeparator(std::string_view(_joint).substr(match.position, match.length), f);
+            _carry.clear();
+
+            const auto consumed = match.position + match.length - tail.size();
+            _keep(chunk, _process(chunk, consumed, consumed, false, f));
+            return;
+        }
+
+        // Otherwise the token in the carry ends at the first separator of the chunk.
+        const auto match = _search.find(chunk, 0, _getSeparators());
+        if (match.position == npos || match.position + _maxLength >= chunk.size()) {
+            const auto previousSize = _carry.size();
+            _carry.append(chunk);
+            _scanFrom = std::max(previousSize, _carry.size() - std::min(_carry.size(), _maxLength));
+            if (match.position != npos) {
+                _scanFrom = std::min(_scanFrom, previousSize + match.position);
+            }
+            return;
+        }
+
+        _carry.append(chunk.substr(0, match.position));
+        _emitToken(_carry, f);
+        _emitSeparator(chunk.substr(match.position, match.length), f);
+        _carry.clear();
+
+        const auto consumed = match.position + match.length;
+        _keep(chunk, _process(chunk, consumed, consumed, false, f));
+    }
+
+    /**
+     * Ends the input and tokenizes what remains of it. The stream can be reused afterwards.
+     * @param f The callback.
+     */
+    template<typename FunctionT>
+    void finish(FunctionT &&f) {
+        const auto [offset, scan] = _process(_carry, 0, _scanFrom, true, f);
+        // As with tokenize(), the remainder is kept even if trimming empties it.
+        if (const auto remaining = std::string_view(_carry).substr(offset); !remaining.empty()) {
+            _emit(_options.trim ? trimmed(remaining) : remaining, f);
+        }
+        _carry.clear();
+        _scanFrom = 0;
+        _emitted = false;
+    }
+
+    /**
+     * Tokenizes a whole stream, ChunkSize bytes at a time.
+     * @param is The stream.
+     * @param f The callback.
+     */
+    template<typename FunctionT>
+    void read(std::istream &is, FunctionT &&f) {
+        auto buffer = std::make_unique_for_overwrite<char[]>(ChunkSize);
+        while (is.read(buffer.get(), ChunkSize) || is.gcount() > 0) {
+            feed({buffer.get(), static_cast<std::size_t>(is.gcount())}, f);
+        }
+        finish(f);
+    }
+
+    /**
+     * Tokenizes a whole file through a memory mapping. Pages are released once they have been tokenized, so the file
+     * does not stay resident.
+     * @param path The path of the file.
+     * @param f The callback.
+     * @throws IOException if the file cannot be mapped.
+     */
+    template<typename FunctionT>
+    void readFile(const std::filesystem::path &path, FunctionT &&f) {
+        detail::MappedFile file(path);
+        const auto data = file.view();
+        for (std::size_t offset = 0; offset < data.size(); offset += ChunkSize) {
+            feed(data.substr(offset, ChunkSize), f);
+            // Whatever is still needed has been copied to the carry.
+            file.release(offset + ChunkSize);
+        }
+        finish(f);
+    }
+
+private:
+    static constexpr std::size_t npos = std::string_view::npos;
+
+    [[nodiscard]] std::span<const std::string> _getSeparators() const { return _separators; }
+
+    /**
+     * Tokenizes data from a token starting at offset, looking for separators from scan on.
+     * @return The start of the unfinished token and the first position a separator may still start at.
+     */
+    template<typename FunctionT>
+    std::pair<std::size_t, std::size_t> _process(std::string_view data, std::size_t offset, std::size_t scan, bool final,
+                                                 FunctionT &f) {
+        while (true) {
+            const auto match = _search.find(data, scan, _getSeparators());
+            if (match.position == npos || (!final && match.position + _maxLength >= data.size())) {
+                // Separators starting more than _maxLength before the end have been ruled out.
+                const auto undecided = data.size() - std::min(data.size(), _maxLength);
+                return {offset, std::max(scan, std::min(undecided, match.position))};
+            }
+
+            _emitToken(data.substr(offset, match.position - offset), f);
+            _emitSeparator(data.substr(match.position, match.length), f);
+            offset = scan = match.position + match.length;
+        }
+    }
+
+    template<typename FunctionT>
+    void _appendToCarry(std::string_view chunk, FunctionT &f) {
+        _carry.append(chunk);
+        const auto [offset, scan] = _process(_carry, 0, _scanFrom, false, f);
+        _carry.erase(0, offset);
+        _scanFrom = scan - offset;
+    }
+
+    void _keep(std::string_view data, std::pair<std::size_t, std::size_t> unfinished) {
+        const auto [offset, scan] = unfinished;
+        _carry.assign(data.substr(offset));
+        _scanFrom = scan - offset;
+    }
+
+    template<typename FunctionT>
+    void _emitToken(std::string_view token, FunctionT &f) {
+        if (_options.trim) {
+            token = trimmed(token);
+        }
+        // Do not allow the first token to be empty.
+        if ((!_options.skipEmpty || !token.empty()) && (!token.empty() || _emitted)) {
+            _emit(token, f);
+        }
+    }
+
+    template<typename FunctionT>
+    void _emitSeparator(std::string_view separator, FunctionT &f) {
+        if (_options.keepSeparators) {
+            _emit(separator, f);
+        }
+    }
+
+    template<typename FunctionT>
+    void _emit(std::string_view token, FunctionT &f) {
+        _emitted = true;
+        f(token);
+    }
+
+private:
+    std::vector<std::string> _separators;
+    TokenizeOptions _options;
+    basic_separator_search<char, std::string> _search;
+    std::size_t _maxLength = 0;
+
+    std::string _carry;      //< The unfinished token.
+    std::size_t _scanFrom = 0;//< The first position in the carry a separator may still start at.
+    std::string _joint;      //< The end of the carry and the start of a chunk.
+    bool _emitted = false;
+};
+
+}// namespace eni::strings
+
+#endif//ENI_STRINGS_TOKEN_STREAM_H
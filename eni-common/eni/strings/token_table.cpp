@@ -0,0 +1,29 @@
+//
+// Created by void on 10/18/26.
+//
+
+#include <eni/strings/token_table.h>
+
+namespace eni::strings {
+
+namespace detail {
+template<typename SplitViewT>
+void fill_token_table(TokenTable &table, std::string_view str, const SplitViewT &tokens) {
+    table.clear();
+    // Tokens and separators never overlap, so they never take more than the string.
+    table.reserve(0, str.size());
+    for (const auto token : tokens) {
+        table.push_back(token);
+    }
+}
+}// namespace detail
+
+void tokenizeInto(TokenTable &table, std::string_view str, std::span<const std::string> separators, TokenizeOptions options) {
+    detail::fill_token_table(table, str, basic_split_view<char, std::string>(str, separators, options));
+}
+
+void tokenizeInto(TokenTable &table, std::string_view str, std::string_view separator, TokenizeOptions options) {
+    detail::fill_token_table(table, str, basic_split_view<char>(str, separator, options));
+}
+
+}// namespace eni::strings
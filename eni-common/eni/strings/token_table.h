@@ -0,0 +1,179 @@
+//
+// Created by void on 10/18/26.
+//
+
+#ifndef ENI_STRINGS_TOKEN_TABLE_H
+#define ENI_STRINGS_TOKEN_TABLE_H
+
+#include <eni/strings/split_view.h>
+
+#include <cstddef>
+#include <iterator>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace eni::strings {
+
+/**
+ * A columnar list of tokens.
+ *
+ * The bytes of all tokens are stored back to back in one arena, and token i spans offsets()[i] to offsets()[i + 1].
+ * A table does not allocate per token, and clear() keeps its capacity, so a table reused for similar inputs stops
+ * allocating altogether.
+ */
+class TokenTable {
+public:
+    class iterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = std::string_view;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = std::string_view;
+
+        iterator() = default;
+
+        reference operator*() const { return (*_table)[_index]; }
+        reference operator[](difference_type n) const { return (*_table)[_index + static_cast<std::size_t>(n)]; }
+
+        iterator &operator++() {
+            ++_index;
+            return *this;
+        }
+
+        iterator operator++(int) {
+            auto it = *this;
+            ++_index;
+            return it;
+        }
+
+        iterator &operator--() {
+            --_index;
+            return *this;
+        }
+
+        iterator operator--(int) {
+            auto it = *this;
+            --_index;
+            return it;
+        }
+
+        iterator &operator+=(difference_type n) {
+            _index += static_cast<std::size_t>(n);
+            return *this;
+        }
+
+        iterator &operator-=(difference_type n) {
+            _index -= static_cast<std::size_t>(n);
+            return *this;
+        }
+
+        friend iterator operator+(iterator it, difference_type n) { return it += n; }
+        friend iterator operator+(difference_type n, iterator it) { return it += n; }
+        friend iterator operator-(iterator it, difference_type n) { return it -= n; }
+
+        friend difference_type operator-(const iterator &a, const iterator &b) {
+            return static_cast<difference_type>(a._index) - static_cast<difference_type>(b._index);
+        }
+
+        bool operator==(const iterator &other) const { return _index == other._index; }
+        auto operator<=>(const iterator &other) const { return _index <=> other._index; }
+
+    private:
+        friend class TokenTable;
+
+        iterator(const TokenTable *table, std::size_t index) : _table(table), _index(index) {}
+
+    private:
+        const TokenTable *_table = nullptr;
+        std::size_t _index = 0;
+    };
+
+    TokenTable() : _offsets{0} {}
+
+    /**
+     * @return The number of tokens.
+     */
+    [[nodiscard]] std::size_t size() const { return _offsets.size() - 1; }
+
+    [[nodiscard]] bool empty() const { return size() == 0; }
+
+    /**
+     * @return A token, valid until the table is modified.
+     */
+    [[nodiscard]] std::string_view operator[](std::size_t index) const {
+        return std::string_view(_bytes).substr(_offsets[index], _offsets[index + 1] - _offsets[index]);
+    }
+
+    [[nodiscard]] iterator begin() const { return {this, 0}; }
+    [[nodiscard]] iterator end() const { return {this, size()}; }
+
+    /**
+     * @return The bytes of all tokens.
+     */
+    [[nodiscard]] std::string_view bytes() const { return _bytes; }
+
+    /**
+     * @return The offsets of the tokens in bytes(), followed by the size of bytes().
+     */
+    [[nodiscard]] std::span<const std::size_t> offsets() const { return _offsets; }
+
+    /**
+     * Appends a token.
+     */
+    void push_back(std::string_view token) {
+        _bytes.append(token);
+        _offsets.push_back(_bytes.size());
+    }
+
+    /**
+     * Removes all tokens, keeping the memory for reuse.
+     */
+    void clear() {
+        _bytes.clear();
+        _offsets.resize(1);
+    }
+
+    /**
+     * Reserves memory for tokens.
+     * @param tokens The number of tokens.
+     * @param bytes The total size of the tokens.
+     */
+    void reserve(std::size_t tokens, std::size_t bytes) {
+        _offsets.reserve(tokens + 1);
+        _bytes.reserve(bytes);
+    }
+
+    /**
+     * @return Copies of the tokens.
+     */
+    [[nodiscard]] std::vector<std::string> toVector() const { return {begin(), end()}; }
+
+private:
+    std::string _bytes;
+    std::vector<std::size_t> _offsets;
+};
+
+/**
+ * Splits a string into tokens, with the same semantics as tokenize(), and stores them into a table.
+ * @param table The table to fill, cleared first.
+ * @param str The string to tokenize.
+ * @param separators A list of separators.
+ * @param options How to tokenize.
+ */
+void tokenizeInto(TokenTable &table, std::string_view str, std::span<const std::string> separators, TokenizeOptions options = {});
+
+/**
+ * Splits a string into tokens, with the same semantics as tokenize(), and stores them into a table.
+ * @param table The table to fill, cleared first.
+ * @param str The string to tokenize.
+ * @param separator The separator.
+ * @param options How to tokenize.
+ */
+void tokenizeInto(TokenTable &table, std::string_view str, std::string_view separator, TokenizeOptions options = {});
+
+}// namespace eni::strings
+
+#endif//ENI_STRINGS_TOKEN_TABLE_H
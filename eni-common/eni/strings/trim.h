@@ -0,0 +1,158 @@
+//
+// Created by void on 10/18/26.
+//
+
+#ifndef ENI_STRINGS_TRIM_H
+#define ENI_STRINGS_TRIM_H
+
+#include <eni/build_config.h>
+
+#include <bit>
+#include <cstddef>
+#include <string_view>
+#include <type_traits>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace eni::strings {
+
+/**
+ * @return Whether a character is whitespace as trimmed by default: a space, a tab, a line feed or a carriage return.
+ */
+template<typename CharT>
+constexpr bool isWhitespace(CharT c) {
+    return c == CharT(' ') || c == CharT('\t') || c == CharT('\n') || c == CharT('\r');
+}
+
+namespace detail {
+#if defined(__SSE2__)
+/**
+ * @return A movemask of the bytes of the 16 bytes at data that belong to whitespace characters.
+ */
+template<typename CharT>
+uint32 whitespace_mask(const CharT *data) {
+    static_assert(sizeof(CharT) == 1 || sizeof(CharT) == 4);
+
+    const auto block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data));
+    const auto is = [&block](char c) {
+        if constexpr (sizeof(CharT) == 1) {
+            return _mm_cmpeq_epi8(block, _mm_set1_epi8(c));
+        } else {
+            return _mm_cmpeq_epi32(block, _mm_set1_epi32(c));
+        }
+    };
+    return static_cast<uint32>(_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(is(' '), is('\t')), _mm_or_si128(is('\n'), is('\r')))));
+}
+#endif
+
+/**
+ * @return The position of the first character that is not whitespace, or str.size().
+ */
+template<typename CharT>
+constexpr std::size_t skip_whitespace(std::basic_string_view<CharT> str) {
+    // Most strings do not start with whitespace, do not pay for a vector load then.
+    if (str.empty() || !isWhitespace(str.front())) {
+        return 0;
+    }
+
+    std::size_t position = 1;
+#if defined(__SSE2__)
+    if constexpr (sizeof(CharT) == 1 || sizeof(CharT) == 4) {
+        if (!std::is_constant_evaluated()) {
+            constexpr std::size_t lanes = 16 / sizeof(CharT);
+            for (; position + lanes <= str.size(); position += lanes) {
+                if (const auto mask = whitespace_mask(str.data() + position); mask != 0xFFFF) {
+                    return position + static_cast<std::size_t>(std::countr_one(mask)) / sizeof(CharT);
+                }
+            }
+        }
+    }
+#endif
+
+    while (position < str.size() && isWhitespace(str[position])) {
+        position++;
+    }
+    return position;
+}
+
+/**
+ * @return The position after the last character that is not whitespace, or 0.
+ */
+template<typename CharT>
+constexpr std::size_t skip_whitespace_back(std::basic_string_view<CharT> str) {
+    if (str.empty() || !isWhitespace(str.back())) {
+        return str.size();
+    }
+
+    std::size_t position = str.size() - 1;
+#if defined(__SSE2__)
+    if constexpr (sizeof(CharT) == 1 || sizeof(CharT) == 4) {
+        if (!std::is_constant_evaluated()) {
+            constexpr std::size_t lanes = 16 / sizeof(CharT);
+            for (; position >= lanes; position -= lanes) {
+                if (const auto mask = whitespace_mask(str.data() + position - lanes); mask != 0xFFFF) {
+                    return position - static_cast<std::size_t>(std::countl_one(mask << 16)) / sizeof(CharT);
+                }
+            }
+        }
+    }
+#endif
+
+    while (position > 0 && isWhitespace(str[position - 1])) {
+        position--;
+    }
+    return position;
+}
+
+template<typename CharT>
+constexpr std::basic_string_view<CharT> trimmed_chars(std::basic_string_view<CharT> str, std::basic_string_view<CharT> chars) {
+    const auto from = str.find_first_not_of(chars);
+    if (from == std::basic_string_view<CharT>::npos) {
+        return str.substr(str.size());
+    }
+    return str.substr(from, str.find_last_not_of(chars) - from + 1);
+}
+}// namespace detail
+
+/**
+ * Trims whitespace (see isWhitespace()) from the left of a string without copying it. Whitespace runs are skipped 16
+ * bytes at a time.
+ * @return The view of str without its leading whitespace.
+ */
+constexpr std::string_view trimmedLeft(std::string_view str) { return str.substr(detail::skip_whitespace(str)); }
+
+constexpr std::wstring_view trimmedLeft(std::wstring_view str) { return str.substr(detail::skip_whitespace(str)); }
+
+/**
+ * Trims whitespace (see isWhitespace()) from the right of a string without copying it. Whitespace runs are skipped 16
+ * bytes at a time.
+ * @return The view of str without its trailing whitespace.
+ */
+constexpr std::string_view trimmedRight(std::string_view str) { return str.substr(0, detail::skip_whitespace_back(str)); }
+
+constexpr std::wstring_view trimmedRight(std::wstring_view str) { return str.substr(0, detail::skip_whitespace_back(str)); }
+
+/**
+ * Trims whitespace (see isWhitespace()) from both sides of a string without copying it. Whitespace runs are skipped 16
+ * bytes at a time.
+ * @return The view of str without its leading and trailing whitespace.
+ */
+constexpr std::string_view trimmed(std::string_view str) { return trimmedLeft(trimmedRight(str)); }
+
+constexpr std::wstring_view trimmed(std::wstring_view str) { return trimmedLeft(trimmedRight(str)); }
+
+/**
+ * Trims a set of characters from both sides of a string without copying it.
+ * @param str The string to trim.
+ * @param chars The characters to remove.
+ * @return The view of str without its leading and trailing characters from chars.
+ */
+constexpr std::string_view trimmed(std::string_view str, std::string_view chars) { return detail::trimmed_chars(str, chars); }
+
+constexpr std::wstring_view trimmed(std::wstring_view str, std::wstring_view chars) { return detail::trimmed_chars(str, chars); }
+
+}// namespace eni::strings
+
+#endif//ENI_STRINGS_TRIM_H
@@ -0,0 +1,375 @@
+//
+// Created by void on 10/18/26.
+//
+
+#include <eni/strings/utf8.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace eni::strings {
+
+static_assert(sizeof(wchar_t) == 4, "Wide strings are expected to be UTF-32");
+
+namespace detail {
+/**
+ * Converts the leading ASCII run of a block-aligned prefix.
+ * @return The number of characters converted.
+ */
+inline std::size_t asciiToWide([[maybe_unused]] const char *in, [[maybe_unused]] std::size_t count, [[maybe_unused]] wchar_t *out) {
+    std::size_t i = 0;
+#if defined(__SSE2__)
+    const auto zero = _mm_setzero_si128();
+    for (; i + 16 <= count; i += 16) {
+        const auto bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+        if (_mm_movemask_epi8(bytes) != 0) {
+            break;
+        }
+
+        const auto lo = _mm_unpacklo_epi8(bytes, zero);
+        const auto hi = _mm_unpackhi_epi8(bytes, zero);
+        auto *dst = reinterpret_cast<__m128i *>(out + i);
+        _mm_storeu_si128(dst, _mm_unpacklo_epi16(lo, zero));
+        _mm_storeu_si128(dst + 1, _mm_unpackhi_epi16(lo, zero));
+        _mm_storeu_si128(dst + 2, _mm_unpacklo_epi16(hi, zero));
+        _mm_storeu_si128(dst + 3, _mm_unpackhi_epi16(hi, zero));
+    }
+#endif
+    return i;
+}
+
+inline std::size_t asciiFromWide([[maybe_unused]] const wchar_t *in, [[maybe_unused]] std::size_t count, [[maybe_unused]] char *out) {
+    std::size_t i = 0;
+#if defined(__SSE2__)
+    const auto nonAscii = _mm_set1_epi32(~0x7F);
+    const auto zero = _mm_setzero_si128();
+    for (; i + 16 <= count; i += 16) {
+        const auto *src = reinterpret_cast<const __m128i *>(in + i);
+        const auto a = _mm_loadu_si128(src);
+        const auto b = _mm_loadu_si128(src + 1);
+        const auto c = _mm_loadu_si128(src + 2);
+        const auto d = _mm_loadu_si128(src + 3);
+
+        const auto any = _mm_and_si128(_mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d)), nonAscii);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(any, zero)) != 0xFFFF) {
+            break;
+        }
+
+        const auto packed = _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), packed);
+    }
+#endif
+    return i;
+}
+
+/**
+ * @return The length of the ASCII prefix, found 16 bytes at a time, or 8 bytes at a time without SSE2. Only whole
+ * blocks are checked, the last 15 bytes are left to the caller.
+ */
+inline std::size_t asciiPrefix(const char *in, std::size_t count) {
+    std::size_t i = 0;
+#if defined(__SSE2__)
+    for (; i + 16 <= count; i += 16) {
+        const auto bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+        if (const auto mask = static_cast<uint32>(_mm_movemask_epi8(bytes)); mask != 0) {
+            return i + static_cast<std::size_t>(std::countr_zero(mask));
+        }
+    }
+#else
+    for (; i + 16 <= count; i += 8) {
+        uint64 word = 0;
+        std::memcpy(&word, in + i, sizeof(word));
+        if (const auto high = word & 0x8080808080808080ULL; high != 0) {
+            const auto bit = std::endian::native == std::endian::little ? std::countr_zero(high) : std::countl_zero(high);
+            return i + static_cast<std::size_t>(bit) / 8;
+        }
+    }
+#endif
+    return i;
+}
+
+inline bool isContinuation(unsigned char c) {
+    return (c & 0xC0) == 0x80;
+}
+
+/**
+ * Decodes the multibyte sequence at in[i], advancing i past it on success.
+ */
+inline UtfError decodeMultibyte(const char *in, std::size_t size, std::size_t &i, uint32 &codePoint) {
+    static constexpr uint32 minimums[] = {0, 0, 0x80, 0x800, 0x10000};
+
+    // The number of leading ones of the first byte is the length of the sequence.
+    const auto c = static_cast<unsigned char>(in[i]);
+    const auto length = static_cast<std::size_t>(std::countl_one(c));
+    if (length < 2 || length > 4 || i + length > size) {
+        return UtfError::InvalidSequence;
+    }
+
+    codePoint = c & (0x7Fu >> length);
+    for (std::size_t k = 1; k < length; ++k) {
+        const auto continuation = static_cast<unsigned char>(in[i + k]);
+        if (!isContinuation(continuation)) {
+            return UtfError::InvalidSequence;
+        }
+        codePoint = (codePoint << 6) | (continuation & 0x3F);
+    }
+
+    const auto minimum = minimums[length];
+    if (codePoint < minimum) {
+        return UtfError::Overlong;
+    }
+    if (codePoint >= 0xD800 && codePoint <= 0xDFFF) {
+        return UtfError::Surrogate;
+    }
+    if (codePoint > 0x10FFFF) {
+        return UtfError::OutOfRange;
+    }
+
+    i += length;
+    return UtfError::None;
+}
+}// namespace detail
+
+const char *to_string(UtfError error) {
+    switch (error) {
+        case UtfError::None:
+            return "no error";
+        case UtfError::InvalidSequence:
+            return "invalid UTF-8 sequence";
+        case UtfError::Overlong:
+            return "overlong UTF-8 sequence";
+        case UtfError::Surrogate:
+            return "surrogate code point";
+        case UtfError::OutOfRange:
+            return "code point out of range";
+        case UtfError::OutputTooSmall:
+            return "output buffer too small";
+    }
+    return "unknown error";
+}
+
+TranscodeResult toWide(std::span<const char> utf8, std::span<wchar_t> wide) {
+    const auto *in = utf8.data();
+    auto *out = wide.data();
+    const auto size = utf8.size();
+    const auto capacity = wide.size();
+
+    std::size_t i = 0;
+    std::size_t o = 0;
+    std::size_t nextBlock = 0;
+    while (i < size) {
+        if (const auto n = std::min(size - i, capacity - o); n >= 16 && i >= nextBlock) {
+            const auto ascii = detail::asciiToWide(in + i, n, out + o);
+            i += ascii;
+            o += ascii;
+            if (i == size) {
+                break;
+            }
+            // The next block is not pure ASCII, convert it one character at a time.
+            nextBlock = i + 16;
+        }
+
+        if (o == capacity) {
+            return {UtfError::OutputTooSmall, i, o};
+        }
+
+        const auto c = static_cast<unsigned char>(in[i]);
+        if (c < 0x80) {
+            out[o++] = static_cast<wchar_t>(c);
+            i++;
+            continue;
+        }
+
+        uint32 codePoint = 0;
+        if (const auto error = detail::decodeMultibyte(in, size, i, codePoint); error != UtfError::None) {
+            return {error, i, o};
+        }
+        out[o++] = static_cast<wchar_t>(codePoint);
+    }
+
+    return {UtfError::None, i, o};
+}
+
+TranscodeResult fromWide(std::span<const wchar_t> wide, std::span<char> utf8) {
+    const auto *in = wide.data();
+    auto *out = utf8.data();
+    const auto size = wide.size();
+    const auto capacity = utf8.size();
+
+    std::size_t i = 0;
+    std::size_t o = 0;
+    std::size_t nextBlock = 0;
+    while (i < size) {
+        if (const auto n = std::min(size - i, capacity - o); n >= 16 && i >= nextBlock) {
+            const auto ascii = detail::asciiFromWide(in + i, n, out + o);
+            i += ascii;
+            o += ascii;
+            if (i == size) {
+                break;
+            }
+            // The next block is not pure ASCII, convert it one character at a time.
+            nextBlock = i + 16;
+        }
+
+        const auto codePoint = static_cast<uint32>(in[i]);
+        if (codePoint < 0x80) {
+            if (o == capacity) {
+                return {UtfError::OutputTooSmall, i, o};
+            }
+            out[o++] = static_cast<char>(codePoint);
+        } else if (codePoint < 0x800) {
+            if (o + 2 > capacity) {
+                return {UtfError::OutputTooSmall, i, o};
+            }
+            out[o++] = static_cast<char>(0xC0 | (codePoint >> 6));
+            out[o++] = static_cast<char>(0x80 | (codePoint & 0x3F));
+        } else if (codePoint < 0x10000) {
+            if (codePoint >= 0xD800 && codePoint <= 0xDFFF) {
+                return {UtfError::Surrogate, i, o};
+            }
+            if (o + 3 > capacity) {
+                return {UtfError::OutputTooSmall, i, o};
+            }
+            out[o++] = static_cast<char>(0xE0 | (codePoint >> 12));
+            out[o++] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+            out[o++] = static_cast<char>(0x80 | (codePoint & 0x3F));
+        } else if (codePoint <= 0x10FFFF) {
+            if (o + 4 > capacity) {
+                return {UtfError::OutputTooSmall, i, o};
+            }
+            out[o++] = static_cast<char>(0xF0 | (codePoint >> 18));
+            out[o++] = static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+            out[o++] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+            out[o++] = static_cast<char>(0x80 | (codePoint & 0x3F));
+        } else {
+            return {UtfError::OutOfRange, i, o};
+        }
+        i++;
+    }
+
+    return {UtfError::None, i, o};
+}
+
+std::size_t getUtf8Length(std::span<const wchar_t> wide) {
+    // Branchless, so the compiler can vectorize it.
+    std::size_t length = 0;
+    for (const auto c : wide) {
+        const auto codePoint = static_cast<uint32>(c);
+        length += 1 + static_cast<std::size_t>(codePoint >= 0x80) + static_cast<std::size_t>(codePoint >= 0x800) +
+                  static_cast<std::size_t>(codePoint >= 0x10000);
+    }
+    return length;
+}
+
+UtfError decodeCodePoint(std::string_view utf8, std::size_t &position, char32_t &codePoint) {
+    if (position >= utf8.size()) {
+        return UtfError::InvalidSequence;
+    }
+    if (const auto c = static_cast<unsigned char>(utf8[position]); c < 0x80) {
+        codePoint = c;
+        position++;
+        return UtfError::None;
+    }
+
+    uint32 decoded = 0;
+    const auto error = detail::decodeMultibyte(utf8.data(), utf8.size(), position, decoded);
+    codePoint = static_cast<char32_t>(decoded);
+    return error;
+}
+
+std::size_t encodeCodePoint(char32_t codePoint, std::span<char, 4> utf8) {
+    const auto wide = static_cast<wchar_t>(codePoint);
+    const auto result = fromWide(std::span(&wide, 1), utf8);
+    return result ? result.written : 0;
+}
+
+Utf8Validation validateUtf8(std::string_view utf8) {
+    const auto *in = utf8.data();
+    const auto size = utf8.size();
+
+    std::size_t i = 0;
+    while (i < size) {
+        i += detail::asciiPrefix(in + i, size - i);
+        // Check the tail and the non-ASCII characters one at a time, until the next ASCII byte.
+        while (i < size && (static_cast<unsigned char>(in[i]) >= 0x80 || size - i < 16)) {
+            if (static_cast<unsigned char>(in[i]) < 0x80) {
+                i++;
+                continue;
+            }
+            uint32 codePoint = 0;
+            if (const auto error = detail::decodeMultibyte(in, size, i, codePoint); error != UtfError::None) {
+                return {error, i};
+            }
+        }
+    }
+    return {UtfError::None, size};
+}
+
+bool isValidUtf8(std::string_view utf8) {
+    return static_cast<bool>(validateUtf8(utf8));
+}
+
+std::size_t countCodePoints(std::string_view utf8) {
+    const auto *in = utf8.data();
+    const auto size = utf8.size();
+
+    std::size_t count = 0;
+    std::size_t i = 0;
+#if defined(__SSE2__)
+    // Every byte that is not a continuation byte (0x80 - 0xBF, -128 - -65 signed) starts a code point. Starts are
+    // counted per byte lane, and the lanes are summed before they can overflow.
+    const auto lastContinuation = _mm_set1_epi8(static_cast<char>(0xBF));
+    const auto zero = _mm_setzero_si128();
+    while (i + 16 <= size) {
+        auto lanes = _mm_setzero_si128();
+        const auto end = std::min(size - (size - i) % 16, i + 255 * 16);
+        for (; i < end; i += 16) {
+            const auto bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+            lanes = _mm_sub_epi8(lanes, _mm_cmpgt_epi8(bytes, lastContinuation));
+        }
+        const auto sums = _mm_sad_epu8(lanes, zero);
+        count += static_cast<std::size_t>(_mm_cvtsi128_si32(sums)) + static_cast<std::size_t>(_mm_extract_epi16(sums, 4));
+    }
+#endif
+    for (; i < size; ++i) {
+        count += static_cast<std::size_t>(!detail::isContinuation(static_cast<unsigned char>(in[i])));
+    }
+    return count;
+}
+
+std::size_t floorCodePointBoundary(std::string_view utf8, std::size_t position) {
+    if (position >= utf8.size()) {
+        return utf8.size();
+    }
+    // A sequence has at most 3 continuation bytes, do not back up further on invalid input.
+    const auto limit = position >= 3 ? position - 3 : 0;
+    while (position > limit && detail::isContinuation(static_cast<unsigned char>(utf8[position]))) {
+        position--;
+    }
+    return position;
+}
+
+std::size_t ceilCodePointBoundary(std::string_view utf8, std::size_t position) {
+    const auto limit = std::min(position + 3, utf8.size());
+    while (position < limit && detail::isContinuation(static_cast<unsigned char>(utf8[position]))) {
+        position++;
+    }
+    return std::min(position, utf8.size());
+}
+
+std::size_t getCodePointOffset(std::string_view utf8, std::size_t index) {
+    std::size_t i = 0;
+    for (; i < utf8.size(); ++i) {
+        if (!detail::isContinuation(static_cast<unsigned char>(utf8[i])) && index-- == 0) {
+            return i;
+        }
+    }
+    return utf8.size();
+}
+
+}// namespace eni::strings
@@ -0,0 +1,127 @@
+//
+// Created by void on 10/18/26.
+//
+
+#ifndef ENI_STRINGS_UTF8_H
+#define ENI_STRINGS_UTF8_H
+
+#include <eni/build_config.h>
+
+#include <cstddef>
+#include <span>
+#include <string_view>
+
+namespace eni::strings {
+
+/**
+ * Why a UTF-8 or wide string could not be transcoded.
+ */
+enum class UtfError : uint8 {
+    None,
+    InvalidSequence,//< A byte that cannot start a sequence, a missing continuation byte or a truncated sequence.
+    Overlong,       //< A code point encoded with more bytes than necessary.
+    Surrogate,      //< A UTF-16 surrogate code point.
+    OutOfRange,     //< A code point above U+10FFFF.
+    OutputTooSmall, //< The output buffer is too small.
+};
+
+/**
+ * The outcome of a transcoding.
+ */
+struct TranscodeResult {
+    UtfError error = UtfError::None;
+    std::size_t read = 0;   //< The number of input units consumed, the position of the error if there is one.
+    std::size_t written = 0;//< The number of output units written.
+
+    explicit operator bool() const { return error == UtfError::None; }
+};
+
+/**
+ * The outcome of a UTF-8 validation.
+ */
+struct Utf8Validation {
+    UtfError error = UtfError::None;
+    std::size_t position = 0;//< The length of the valid prefix, the position of the error if there is one.
+
+    explicit operator bool() const { return error == UtfError::None; }
+};
+
+/**
+ * @return A readable description of an error.
+ */
+const char *to_string(UtfError error);
+
+/**
+ * Converts UTF-8 to a wide string (UTF-32) into a caller buffer. ASCII runs are converted 16 bytes at a time.
+ * @param utf8 The UTF-8 string.
+ * @param wide The buffer to write to, utf8.size() units are always sufficient.
+ * @return The result. On error, nothing after the offending sequence is written.
+ */
+TranscodeResult toWide(std::span<const char> utf8, std::span<wchar_t> wide);
+
+/**
+ * Converts a wide string (UTF-32) to UTF-8 into a caller buffer. ASCII runs are converted 16 characters at a time.
+ * @param wide The wide string.
+ * @param utf8 The buffer to write to, getUtf8Length(wide) or 4 * wide.size() units are always sufficient.
+ * @return The result. On error, nothing after the offending character is written.
+ */
+TranscodeResult fromWide(std::span<const wchar_t> wide, std::span<char> utf8);
+
+/**
+ * @return The number of bytes the UTF-8 encoding of a wide string takes. Invalid characters are counted as if they were encodable.
+ */
+std::size_t getUtf8Length(std::span<const wchar_t> wide);
+
+/**
+ * Decodes the code point at a position of a UTF-8 string.
+ * @param utf8 The UTF-8 string.
+ * @param position The position of the code point, advanced past it on success.
+ * @param codePoint The decoded code point.
+ * @return The error, UtfError::None on success.
+ */
+UtfError decodeCodePoint(std::string_view utf8, std::size_t &position, char32_t &codePoint);
+
+/**
+ * Encodes a code point as UTF-8.
+ * @param codePoint The code point.
+ * @param utf8 The buffer to write to.
+ * @return The number of bytes written, 0 if the code point is a surrogate or out of range.
+ */
+std::size_t encodeCodePoint(char32_t codePoint, std::span<char, 4> utf8);
+
+/**
+ * Validates UTF-8 with the same rules as toWide(), without converting it. ASCII runs are checked 16 bytes at a time.
+ * @return The result, with the position of the first invalid sequence if there is one.
+ */
+Utf8Validation validateUtf8(std::string_view utf8);
+
+/**
+ * @return Whether a string is valid UTF-8.
+ */
+bool isValidUtf8(std::string_view utf8);
+
+/**
+ * Counts the code points of a UTF-8 string, 16 bytes at a time. The string is not validated, every byte that is not a
+ * continuation byte is counted.
+ * @return The number of code points.
+ */
+std::size_t countCodePoints(std::string_view utf8);
+
+/**
+ * @return The start of the code point containing a byte position, or utf8.size() if the position is past the end.
+ */
+std::size_t floorCodePointBoundary(std::string_view utf8, std::size_t position);
+
+/**
+ * @return The first code point boundary at or after a byte position, at most utf8.size().
+ */
+std::size_t ceilCodePointBoundary(std::string_view utf8, std::size_t position);
+
+/**
+ * @return The byte position of the code point with an index, or utf8.size() if there are not that many.
+ */
+std::size_t getCodePointOffset(std::string_view utf8, std::size_t index);
+
+}// namespace eni::strings
+
+#endif//ENI_STRINGS_UTF8_H
@@ -6,6 +6,8 @@
 
 #include <eni/Interceptor.h>
 
+#include <atomic>
+#include <thread>
 #include <utility>
 
 using namespace eni;
@@ -144,4 +146,157 @@ TEST_CASE("Can invoke async interceptor", "[Interceptor]") {
     REQUIRE(0 == interceptor->called);
     future.get();
     REQUIRE(1 == interceptor->called);
-}
\ No newline at end of file
+}
+
+class Payload {
+public:
+    explicit Payload(std::size_t size) : data(size, 'x') {}
+
+    Payload(const Payload &other) : data(other.data) {
+        copies++;
+    }
+
+    Payload(Payload &&other) noexcept = default;
+
+    std::string data;
+
+    static inline std::atomic_size_t copies = 0;
+};
+
+class MyPayloadInterceptor {
+public:
+    std::future<void> consume(const Payload &payload, std::size_t offset) const {
+        seen += payload.data.size() + offset;
+        return std::async(std::launch::deferred, [] {});
+    }
+
+    mutable std::atomic_size_t seen = 0;
+};
+
+TEST_CASE("Async interceptors can share moved arguments", "[Interceptor]") {
+    InterceptorRegistry<MyPayloadInterceptor> reg;
+
+    std::vector<std::shared_ptr<MyPayloadInterceptor>> interceptors;
+    for (int n = 0; n < 3; ++n) {
+        interceptors.push_back(std::make_shared<MyPayloadInterceptor>());
+        reg.registerInterceptor(interceptors.back());
+    }
+
+    Payload::copies = 0;
+    reg.invoke(shared_args, &MyPayloadInterceptor::consume, Payload(1024), std::size_t{1}).get();
+    REQUIRE(0 == Payload::copies);
+
+    Payload payload(16);
+    reg.invoke(std::launch::deferred, shared_args, &MyPayloadInterceptor::consume, payload, std::size_t{0}).get();
+    REQUIRE(1 == Payload::copies);
+
+    for (const auto &interceptor : interceptors) {
+        REQUIRE(1025 + 16 == interceptor->seen);
+    }
+}
+
+class MySleepingInterceptor {
+public:
+    explicit MySleepingInterceptor(std::chrono::milliseconds duration) : _duration(duration) {}
+
+    void invoke() const {
+        std::this_thread::sleep_for(_duration);
+    }
+
+private:
+    std::chrono::milliseconds _duration;
+};
+
+TEST_CASE("Profiler records interceptor calls", "[Interceptor]") {
+    using namespace std::chrono_literals;
+
+    InterceptorRegistry<MySleepingInterceptor, InterceptorProfiler> reg;
+    reg.getProfiler().setBudget(5ms);
+
+    auto fast = std::make_shared<MySleepingInterceptor>(0ms);
+    auto slow = std::make_shared<MySleepingInterceptor>(10ms);
+    reg.registerInterceptor(fast);
+    reg.registerInterceptor(slow);
+
+    reg.invoke(&MySleepingInterceptor::invoke);
+    reg.invoke(&MySleepingInterceptor::invoke);
+
+    const auto fastStatistics = reg.getProfiler().getStatistics(fast.get());
+    const auto slowStatistics = reg.getProfiler().getStatistics(slow.get());
+    REQUIRE(fastStatistics.has_value());
+    REQUIRE(slowStatistics.has_value());
+
+    REQUIRE(2 == fastStatistics->calls);
+    REQUIRE(0 == fastStatistics->budgetExceeded);
+    REQUIRE(2 == slowStatistics->calls);
+    REQUIRE(2 == slowStatistics->budgetExceeded);
+    REQUIRE(slowStatistics->percentile(0.5) >= 5ms);
+    REQUIRE(slowStatistics->averageTime() >= 10ms);
+
+    reg.getProfiler().reset();
+    REQUIRE_FALSE(reg.getProfiler().getStatistics(fast.get()).has_value());
+}
+
+class MySleepingAsyncInterceptor {
+public:
+    std::future<void> invoke() {
+        return std::async(std::launch::async, [] { std::this_thread::sleep_for(std::chrono::milliseconds(10)); });
+    }
+};
+
+TEST_CASE("Profiler measures async interceptors until they complete", "[Interceptor]") {
+    using namespace std::chrono_literals;
+
+    InterceptorRegistry<MySleepingAsyncInterceptor, InterceptorProfiler> reg;
+    auto interceptor = std::make_shared<MySleepingAsyncInterceptor>();
+    reg.registerInterceptor(interceptor);
+
+    reg.invoke(&MySleepingAsyncInterceptor::invoke).get();
+    REQUIRE(reg.getProfiler().getStatistics(interceptor.get())->averageTime() >= 10ms);
+}
+
+class MyFailingAsyncInterceptor {
+public:
+    std::future<void> invoke() {
+        return std::async(std::launch::deferred, [] { throw std::runtime_error("failed asynchronously"); });
+    }
+};
+
+TEST_CASE("Async interceptors are not waited for without profiling", "[Interceptor]") {
+    InterceptorRegistry<MyFailingAsyncInterceptor> reg;
+    reg.registerInterceptor(std::make_shared<MyFailingAsyncInterceptor>());
+    reg.registerInterceptor(std::make_shared<MyFailingAsyncInterceptor>());
+
+    // The deferred futures are discarded without running, so the failures do not reach the caller.
+    REQUIRE_NOTHROW(reg.invoke(&MyFailingAsyncInterceptor::invoke).get());
+
+    InterceptorRegistry<MyFailingAsyncInterceptor, InterceptorProfiler> profiled;
+    profiled.registerInterceptor(std::make_shared<MyFailingAsyncInterceptor>());
+    REQUIRE_THROWS_AS(profiled.invoke(&MyFailingAsyncInterceptor::invoke).get(), std::runtime_error);
+}
+
+TEST_CASE("Profiler forgets unregistered interceptors", "[Interceptor]") {
+    using namespace std::chrono_literals;
+
+    InterceptorRegistry<MySleepingInterceptor, InterceptorProfiler> reg;
+    auto interceptor = std::make_shared<MySleepingInterceptor>(0ms);
+    reg.registerInterceptor(interceptor);
+    reg.registerInterceptor(interceptor);
+
+    reg.invoke(&MySleepingInterceptor::invoke);
+    REQUIRE(reg.getProfiler().getStatistics(interceptor.get())->calls == 2);
+
+    // Still registered once.
+    reg.unregisterInterceptor(interceptor);
+    REQUIRE(reg.getProfiler().getStatistics(interceptor.get()).has_value());
+
+    reg.unregisterInterceptor(interceptor);
+    REQUIRE_FALSE(reg.getProfiler().getStatistics(interceptor.get()).has_value());
+    REQUIRE(reg.getProfiler().getStatistics().empty());
+
+    reg.unregisterInterceptor(interceptor);
+}
+
+TEST_CASE("Profiling is free when disabled", "[Interceptor]") {
+    static_assert(sizeof(InterceptorRegistry<MyInterceptor0>) == sizeof(std::list<std::pair<int32, std::shared_ptr<MyInterceptor0>>>));
+}
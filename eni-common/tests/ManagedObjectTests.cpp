@@ -0,0 +1,192 @@
+//
+// Created by void on 10/18/26.
+//
+
+#include <catch2/catch_all.hpp>
+
+#include <eni/ManagedObject.h>
+#include <eni/memory.h>
+
+#include <array>
+#include <atomic>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace eni;
+
+class MyObject : public ManagedObject<MyObject> {
+public:
+    explicit MyObject(int value) : value(value) {}
+
+    int value;
+    std::array<char, 48> payload{};
+};
+
+class MyPooledObject : public ManagedObject<MyPooledObject, PoolAllocator<MyPooledObject>> {
+public:
+    explicit MyPooledObject(int value) : value(value) {}
+
+    int value;
+    std::array<char, 48> payload{};
+
+protected:
+    void onInit() override {
+        initialized = true;
+    }
+
+public:
+    bool initialized = false;
+};
+
+TEST_CASE("Can create and release managed objects", "[ManagedObject]") {
+    auto object = MyObject::create(42);
+    REQUIRE(object->value == 42);
+
+    object->release();
+    REQUIRE_THROWS_AS(object->release(), std::logic_error);
+}
+
+TEST_CASE("Pooled managed objects reuse their memory", "[ManagedObject]") {
+    auto object = MyPooledObject::create(1);
+    REQUIRE(object->value == 1);
+    REQUIRE(object->initialized);
+
+    auto *address = object.get();
+    object->release();
+    object.reset();
+
+    auto other = MyPooledObject::create(2);
+    REQUIRE(other.get() == address);
+    other->release();
+}
+
+TEST_CASE("Pool reclaims unused chunks", "[ManagedObject]") {
+    std::vector<MyPooledObject::unique_ptr> objects;
+    for (int n = 0; n < 10000; ++n) {
+        objects.push_back(MyPooledObject::create(n));
+    }
+
+    std::set<MyPooledObject *> addresses;
+    for (auto &object : objects) {
+        addresses.insert(object.get());
+    }
+    REQUIRE(addresses.size() == objects.size());
+
+    const auto reserved = PoolAllocator<MyPooledObject>::getReservedBytes();
+    REQUIRE(reserved >= objects.size() * sizeof(MyPooledObject));
+
+    for (auto &object : objects) {
+        object->release();
+    }
+    objects.clear();
+
+    REQUIRE(PoolAllocator<MyPooledObject>::reclaim() > 0);
+    REQUIRE(PoolAllocator<MyPooledObject>::getReservedBytes() < reserved);
+}
+
+class MyThreadExitObject : public ManagedObject<MyThreadExitObject, PoolAllocator<MyThreadExitObject>> {};
+
+TEST_CASE("Pooled objects can be freed after the thread cache is gone", "[ManagedObject]") {
+    struct Holder {
+        MyThreadExitObject::unique_ptr object;
+
+        ~Holder() {
+            object->release();
+        }
+    };
+
+    std::thread([] {
+        // Constructed before the thread cache of the pool, so destroyed after it.
+        thread_local Holder holder;
+        holder.object = MyThreadExitObject::create();
+    }).join();
+
+    // The block has been handed back to the pool, so its chunk is unused.
+    const auto reserved = PoolAllocator<MyThreadExitObject>::getReservedBytes();
+    REQUIRE(reserved > 0);
+    REQUIRE(PoolAllocator<MyThreadExitObject>::reclaim() == reserved);
+}
+
+class MyDeferredObject : public ManagedObject<MyDeferredObject> {
+public:
+    ~MyDeferredObject() {
+        destroyed++;
+    }
+
+    static inline std::atomic_int destroyed = 0;
+};
+
+TEST_CASE("Can defer the destruction of managed objects", "[ManagedObject]") {
+    ReleaseQueue queue;
+    MyDeferredObject::setReleaseQueue(&queue);
+    MyDeferredObject::destroyed = 0;
+
+    for (int n = 0; n < 10; ++n) {
+        auto object = MyDeferredObject::create();
+        object->release();
+    }
+
+    REQUIRE(MyDeferredObject::destroyed == 0);
+    REQUIRE(queue.size() == 10);
+    REQUIRE(queue.getStatistics().peakPending == 10);
+
+    REQUIRE(queue.collect() == 10);
+    REQUIRE(MyDeferredObject::destroyed == 10);
+
+    const auto statistics = queue.getStatistics();
+    REQUIRE(statistics.pending == 0);
+    REQUIRE(statistics.reclaimed == 10);
+    REQUIRE(statistics.collections == 1);
+
+    MyDeferredObject::setReleaseQueue(nullptr);
+    MyDeferredObject::create()->release();
+    REQUIRE(MyDeferredObject::destroyed == 11);
+}
+
+TEST_CASE("Can collect deferred destructions in the background", "[ManagedObject]") {
+    using namespace std::chrono_literals;
+
+    ReleaseQueue queue;
+    MyDeferredObject::setReleaseQueue(&queue);
+    MyDeferredObject::destroyed = 0;
+
+    queue.startBackgroundCollection(1ms);
+    MyDeferredObject::create()->release();
+
+    for (int n = 0; n < 1000 && MyDeferredObject::destroyed == 0; ++n) {
+        std::this_thread::sleep_for(1ms);
+    }
+    queue.stopBackgroundCollection();
+    MyDeferredObject::setReleaseQueue(nullptr);
+
+    REQUIRE(MyDeferredObject::destroyed == 1);
+}
+
+TEST_CASE("Managed object allocation benchmarks", "[.][benchmark][ManagedObject]") {
+    constexpr int count = 1000;
+
+    BENCHMARK("default allocation") {
+        std::vector<MyObject::unique_ptr> objects;
+        objects.reserve(count);
+        for (int n = 0; n < count; ++n) {
+            objects.push_back(MyObject::create(n));
+        }
+        for (auto &object : objects) {
+            object->release();
+        }
+        return objects.size();
+    };
+
+    BENCHMARK("pooled allocation") {
+        std::vector<MyPooledObject::unique_ptr> objects;
+        objects.reserve(count);
+        for (int n = 0; n < count; ++n) {
+            objects.push_back(MyPooledObject::create(n));
+        }
+        for (auto &object : objects) {
+            object->release();
+        }
+        return objects.size();
+    };
+}
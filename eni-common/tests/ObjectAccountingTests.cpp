@@ -0,0 +1,101 @@
+//
+// Created by void on 10/18/26.
+//
+
+// Built as a target of its own with ENI_MANAGED_OBJECT_ACCOUNTING and NDEBUG, so that every translation unit agrees on
+// the layout of ManagedObject and unreleased objects can be destroyed without tripping the assertion of the Deleter.
+
+#include <catch2/catch_all.hpp>
+
+#include <eni/ManagedObject.h>
+#include <eni/SlotMap.h>
+
+#include <algorithm>
+#include <array>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#if !defined(ENI_MANAGED_OBJECT_ACCOUNTING) || !defined(NDEBUG)
+#error "ObjectAccountingTests must be built with ENI_MANAGED_OBJECT_ACCOUNTING and NDEBUG"
+#endif
+
+using namespace eni;
+
+class MyAccountedObject : public ManagedObject<MyAccountedObject> {
+public:
+    std::array<char, 100> payload{};
+};
+
+TEST_CASE("Managed objects are accounted for", "[ManagedObject]") {
+    std::vector<MyAccountedObject::unique_ptr> objects;
+    for (int n = 0; n < 10; ++n) {
+        objects.push_back(MyAccountedObject::create());
+    }
+
+    std::thread([&objects] {
+        for (int n = 0; n < 4; ++n) {
+            objects.back()->release();
+            objects.pop_back();
+        }
+    }).join();
+
+    const auto statistics = ObjectAccounting::getStatistics<MyAccountedObject>();
+    REQUIRE(statistics.typeName == "MyAccountedObject");
+    REQUIRE(statistics.created == 10);
+    REQUIRE(statistics.released == 4);
+    REQUIRE(statistics.destroyed == 4);
+    REQUIRE(statistics.live == 6);
+    REQUIRE(statistics.peak == 10);
+    REQUIRE(statistics.bytes == 6 * sizeof(MyAccountedObject));
+
+    for (auto &object : objects) {
+        object->release();
+    }
+    objects.clear();
+    REQUIRE(ObjectAccounting::getStatistics<MyAccountedObject>().live == 0);
+
+    const auto all = ObjectAccounting::getStatistics();
+    REQUIRE(std::ranges::any_of(all, [](const auto &s) { return s.typeName == "MyAccountedObject"; }));
+}
+
+class MySlotObject : public ManagedObject<MySlotObject> {};
+
+TEST_CASE("Managed objects in slot maps are accounted for", "[ManagedObject]") {
+    SlotMap<MySlotObject> map;
+    const auto handle = map.emplace();
+    map.emplace();
+    map.get(handle)->release();
+    map.erase(handle);
+
+    auto statistics = ObjectAccounting::getStatistics<MySlotObject>();
+    REQUIRE(statistics.created == 2);
+    REQUIRE(statistics.released == 1);
+    REQUIRE(statistics.destroyed == 1);
+    REQUIRE(statistics.live == 1);
+
+    map.clear();
+    statistics = ObjectAccounting::getStatistics<MySlotObject>();
+    REQUIRE(statistics.released == 2);
+    REQUIRE(statistics.destroyed == 2);
+    REQUIRE(statistics.live == 0);
+}
+
+TEST_CASE("Unreleased destructions can be dumped", "[ManagedObject]") {
+    const auto destroyed = ObjectAccounting::getStatistics<MyAccountedObject>().destroyed;
+
+    // Without NDEBUG, the Deleter asserts instead.
+    auto object = MyAccountedObject::create();
+    const auto *address = object.get();
+    object.reset();
+
+    const auto unreleased = ObjectAccounting::getUnreleasedDestructions();
+    REQUIRE_FALSE(unreleased.empty());
+    REQUIRE(unreleased.back().typeName == "MyAccountedObject");
+    REQUIRE(unreleased.back().address == address);
+    REQUIRE(ObjectAccounting::getStatistics<MyAccountedObject>().destroyed == destroyed + 1);
+
+    std::stringstream ss;
+    ObjectAccounting::dump(ss);
+    REQUIRE(ss.str().find("destroyed without release()") != std::string::npos);
+}
@@ -0,0 +1,138 @@
+//
+// Created by void on 10/18/26.
+//
+
+#include <catch2/catch_all.hpp>
+
+#include <eni/SlotMap.h>
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace eni;
+
+class MyEntity : public ManagedObject<MyEntity> {
+public:
+    explicit MyEntity(std::string name) : name(std::move(name)) {}
+
+    std::string name;
+    bool initialized = false;
+    int updates = 0;
+
+protected:
+    void onInit() override {
+        initialized = true;
+    }
+};
+
+TEST_CASE("Can look up objects by handle", "[SlotMap]") {
+    SlotMap<std::string> map;
+    auto a = map.emplace("a");
+    auto b = map.emplace("b");
+
+    REQUIRE(map.size() == 2);
+    REQUIRE(*map.get(a) == "a");
+    REQUIRE(*map.get(b) == "b");
+    REQUIRE(map.get(SlotHandle()) == nullptr);
+    REQUIRE(map.getHandle(*map.get(b)) == b);
+}
+
+TEST_CASE("Handles stay stable across removals", "[SlotMap]") {
+    SlotMap<int> map;
+    auto a = map.emplace(1);
+    auto b = map.emplace(2);
+    auto c = map.emplace(3);
+
+    REQUIRE(map.erase(a));
+    REQUIRE_FALSE(map.erase(a));
+    REQUIRE_FALSE(map.contains(a));
+    REQUIRE(map.get(a) == nullptr);
+    REQUIRE(*map.get(b) == 2);
+    REQUIRE(*map.get(c) == 3);
+
+    // The freed slot is reused, but the old handle must not resolve to the new object
+    auto d = map.emplace(4);
+    REQUIRE(d.getIndex() == a.getIndex());
+    REQUIRE(d != a);
+    REQUIRE(map.get(a) == nullptr);
+    REQUIRE(*map.get(d) == 4);
+}
+
+TEST_CASE("Objects are stored densely", "[SlotMap]") {
+    SlotMap<int> map;
+    std::vector<SlotHandle> handles;
+    for (int n = 0; n < 100; ++n) {
+        handles.push_back(map.emplace(n));
+    }
+    for (int n = 0; n < 100; n += 2) {
+        map.erase(handles[n]);
+    }
+
+    REQUIRE(map.size() == 50);
+    REQUIRE(std::distance(map.begin(), map.end()) == 50);
+
+    for (std::size_t i = 0; i < map.size(); ++i) {
+        REQUIRE(map.get(map.getHandle(i)) == map.data() + i);
+    }
+    for (int n = 1; n < 100; n += 2) {
+        REQUIRE(*map.get(handles[n]) == n);
+    }
+}
+
+TEST_CASE("Managed objects are initialized and released", "[SlotMap]") {
+    SlotMap<MyEntity> map;
+    auto handle = map.emplace("player");
+    map.emplace("enemy");
+
+    REQUIRE(map.get(handle)->initialized);
+
+    for (auto &entity : map) {
+        entity.updates++;
+    }
+    REQUIRE(map.get(handle)->updates == 1);
+
+    REQUIRE(map.erase(handle));
+    REQUIRE(map.size() == 1);
+    REQUIRE(map.begin()->name == "enemy");
+}
+
+TEST_CASE("Managed objects released early are not released again", "[SlotMap]") {
+    auto map = std::make_unique<SlotMap<MyEntity>>();
+    const auto handle = map->emplace("player");
+    map->emplace("enemy");
+
+    map->get(handle)->release();
+    REQUIRE(map->erase(handle));
+
+    map->begin()->release();
+    REQUIRE_NOTHROW(map.reset());
+}
+
+class MyNamedEntity : public MyEntity {
+public:
+    explicit MyNamedEntity(std::string name, int *releases) : MyEntity(std::move(name)), _releases(releases) {}
+
+protected:
+    void onRelease() override {
+        (*_releases)++;
+    }
+
+private:
+    int *_releases;
+};
+
+TEST_CASE("Objects derived from managed objects are initialized and released", "[SlotMap]") {
+    int releases = 0;
+    SlotMap<MyNamedEntity> map;
+    const auto handle = map.emplace("player", &releases);
+    map.emplace("enemy", &releases);
+
+    REQUIRE(map.get(handle)->initialized);
+    REQUIRE(map.erase(handle));
+    REQUIRE(releases == 1);
+
+    map.clear();
+    REQUIRE(releases == 2);
+}
@@ -0,0 +1,1051 @@
+//
+// Created by void on 10/18/26.
+//
+
+#include <catch2/catch_all.hpp>
+
+#include <eni/exception.h>
+#include <eni/strings.h>
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <clocale>
+#include <codecvt>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <locale>
+#include <random>
+#include <ranges>
+#include <set>
+#include <shared_mutex>
+#include <sstream>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+using namespace eni;
+
+TEST_CASE("Can tokenize strings", "[Strings]") {
+    using V = std::vector<std::string>;
+
+    REQUIRE(strings::tokenize("a, b,,c", ",") == V{"a", "b", "c"});
+    REQUIRE(strings::tokenize("a, b,,c", ",", false) == V{"a", " b", "c"});
+    REQUIRE(strings::tokenize("a, b,,c", ",", true, false) == V{"a", "b", "", "c"});
+    REQUIRE(strings::tokenize(",a", ",", true, false) == V{"a"});
+    REQUIRE(strings::tokenize("a+b-c", V{"+", "-"}, true, true, true) == V{"a", "+", "b", "-", "c"});
+    REQUIRE(strings::tokenize("a::b:c", V{"::", ":"}) == V{"a", "b", "c"});
+    REQUIRE(strings::tokenize("a,b,", ",") == V{"a", "b,"});
+    REQUIRE(strings::tokenize("a,   ", ",") == V{"a", ""});
+    REQUIRE(strings::tokenize("", ",").empty());
+}
+
+TEST_CASE("Tokenizing UTF-8 matches tokenizing wide strings", "[Strings]") {
+    const std::vector<std::string> inputs = {
+            "grüße→welt→ça va",
+            "日本→語 → テキスト→",
+            "→→a→b",
+            "  x → y → 😀 ",
+    };
+    const std::vector<std::string> separators = {"→", " "};
+
+    std::vector<std::wstring> wideSeparators;
+    for (const auto &separator : separators) {
+        wideSeparators.push_back(strings::toWide(separator));
+    }
+
+    for (const auto &input : inputs) {
+        for (const auto trim : {false, true}) {
+            for (const auto skipEmpty : {false, true}) {
+                for (const auto keepSeparators : {false, true}) {
+                    std::vector<std::string> expected;
+                    for (const auto &token : strings::tokenize(strings::toWide(input), wideSeparators, trim, skipEmpty, keepSeparators)) {
+                        expected.push_back(strings::fromWide(token));
+                    }
+                    REQUIRE(strings::tokenize(input, separators, trim, skipEmpty, keepSeparators) == expected);
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("Can split strings lazily", "[Strings]") {
+    using V = std::vector<std::string_view>;
+    static_assert(std::ranges::forward_range<strings::basic_split_view<char>>);
+    static_assert(std::ranges::view<strings::basic_split_view<char>>);
+
+    auto collect = [](auto &&range) {
+        V tokens;
+        for (const auto token : range) {
+            tokens.push_back(token);
+        }
+        return tokens;
+    };
+
+    REQUIRE(collect(strings::split_view("a, b,,c", ",")) == V{"a", "b", "c"});
+    REQUIRE(collect(strings::split_view("a, b,,c", ",", {.trim = false})) == V{"a", " b", "c"});
+    REQUIRE(collect(strings::split_view("a, b,,c", ",", {.skipEmpty = false})) == V{"a", "b", "", "c"});
+    REQUIRE(collect(strings::split_view("", ",")).empty());
+
+    const std::string_view separators[] = {"+", "-"};
+    REQUIRE(collect(strings::split_view("a+b-c", separators, {.keepSeparators = true})) == V{"a", "+", "b", "-", "c"});
+    REQUIRE(collect(strings::split_view(",,+a", separators, {.skipEmpty = false, .keepSeparators = true})) == V{",,", "+", "a"});
+
+    const std::string text = "x = 1; y = 2";
+    auto tokens = strings::split_view(text, ";");
+    REQUIRE(tokens.front().data() >= text.data());
+    REQUIRE(tokens.front().data() < text.data() + text.size());
+    REQUIRE(std::ranges::distance(tokens) == 2);
+
+    const std::vector<std::wstring> wideSeparators = {L"→"};
+    REQUIRE(std::ranges::distance(strings::split_view(L"a→b→c", wideSeparators)) == 3);
+}
+
+TEST_CASE("Lazy splitting matches tokenize", "[Strings]") {
+    const std::vector<std::string> inputs = {"a,,b,", ",a,", ",,", " , a ,b ; ; c", "abc", ";", "a;"};
+    const std::vector<std::string> separators = {",", ";", ", "};
+
+    for (const auto &input : inputs) {
+        for (const auto trim : {false, true}) {
+            for (const auto skipEmpty : {false, true}) {
+                for (const auto keepSeparators : {false, true}) {
+                    const auto expected = strings::tokenize(input, separators, trim, skipEmpty, keepSeparators);
+                    std::vector<std::string> actual;
+                    for (const auto token : strings::split_view(input, separators, {trim, skipEmpty, keepSeparators})) {
+                        actual.emplace_back(token);
+                    }
+                    REQUIRE(actual == expected);
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("Can search for many separators", "[Strings]") {
+    std::vector<std::string> separators;
+    for (const auto *word : {"and", "or", "not", "xor", "nand", "nor", "an", "o", "then", "else", "if", "n", "→"}) {
+        separators.emplace_back(word);
+    }
+
+    const std::vector<std::string> inputs = {
+            "if a and b or not c then d else e",
+            "nandnornotxor",
+            "random text without → any nonsense or so",
+            "andand",
+            "n",
+            "",
+    };
+
+    for (std::size_t count = 1; count <= separators.size(); ++count) {
+        const std::span<const std::string> subset(separators.data(), count);
+        const strings::basic_separator_search<char, std::string> search(subset);
+
+        for (const auto &input : inputs) {
+            for (std::size_t from = 0; from <= input.size(); ++from) {
+                // Reference: try every separator at every position.
+                strings::basic_separator_search<char, std::string>::match expected;
+                for (auto n = from; n < input.size() && expected.position == std::string::npos; ++n) {
+                    for (std::size_t i = 0; i < count; ++i) {
+                        if (n + subset[i].size() < input.size() && input.compare(n, subset[i].size(), subset[i]) == 0) {
+                            expected = {n, i, subset[i].size()};
+                            break;
+                        }
+                    }
+                }
+
+                const auto actual = search.find(input, from, subset);
+                REQUIRE(actual.position == expected.position);
+                REQUIRE(actual.separator == expected.separator);
+            }
+        }
+    }
+
+    // More distinct first units than MaxSimdUnits, but too few separators for the automaton.
+    const std::vector<std::string> distinct = {"a", "b", "c", "d", "e", "f", "g"};
+    const strings::basic_separator_search<char, std::string> distinctSearch(distinct);
+    REQUIRE(distinctSearch.find("xxxxxxxxxxxxxxxxxxgxx", 0, distinct).position == 18);
+    REQUIRE(distinctSearch.find("xxxxxxxxxxxxxxxxxxfbx", 0, distinct).separator == 5);
+    REQUIRE(strings::tokenize(std::string("1f2a3g4"), distinct) == std::vector<std::string>{"1", "2", "3", "4"});
+
+    const std::vector<std::wstring> wideSeparators = {L"→", L"⇒", L"a", L"b", L"c", L"d", L"e", L"f", L"g", L"h"};
+    REQUIRE(strings::tokenize(std::wstring(L"x→y⇒zaq"), wideSeparators) == std::vector<std::wstring>{L"x", L"y", L"z", L"q"});
+}
+
+TEST_CASE("Can transcode between UTF-8 and wide strings", "[Strings]") {
+    const std::string ascii(100, 'a');
+    REQUIRE(strings::toWide(ascii) == std::wstring(100, L'a'));
+    REQUIRE(strings::fromWide(std::wstring(100, L'a')) == ascii);
+
+    const std::string mixed = ascii + "grüße, 日本語, 😀" + ascii;
+    const std::wstring wideMixed = std::wstring(100, L'a') + L"grüße, 日本語, 😀" + std::wstring(100, L'a');
+    REQUIRE(strings::toWide(mixed) == wideMixed);
+    REQUIRE(strings::fromWide(wideMixed) == mixed);
+    REQUIRE(strings::getUtf8Length(wideMixed) == mixed.size());
+    REQUIRE(strings::toWide("").empty());
+
+    std::array<wchar_t, 8> buffer{};
+    auto result = strings::toWide(std::string_view("abc€"), buffer);
+    REQUIRE(result);
+    REQUIRE(result.read == 6);
+    REQUIRE(std::wstring_view(buffer.data(), result.written) == L"abc€");
+
+    result = strings::toWide(std::string_view("0123456789"), buffer);
+    REQUIRE(result.error == strings::UtfError::OutputTooSmall);
+    REQUIRE(result.written == 8);
+
+    std::array<char, 4> small{};
+    result = strings::fromWide(std::wstring_view(L"ab€"), small);
+    REQUIRE(result.error == strings::UtfError::OutputTooSmall);
+    REQUIRE(result.read == 2);
+}
+
+TEST_CASE("Invalid UTF-8 is reported", "[Strings]") {
+    std::array<wchar_t, 16> buffer{};
+    auto check = [&buffer](std::string_view utf8, strings::UtfError error, std::size_t position) {
+        const auto result = strings::toWide(utf8, buffer);
+        REQUIRE(result.error == error);
+        REQUIRE(result.read == position);
+    };
+
+    check("ab\x80", strings::UtfError::InvalidSequence, 2);
+    check("ab\xC3", strings::UtfError::InvalidSequence, 2);
+    check("ab\xC3(", strings::UtfError::InvalidSequence, 2);
+    check("\xC0\xAF", strings::UtfError::Overlong, 0);
+    check("\xE0\x80\xAF", strings::UtfError::Overlong, 0);
+    check("x\xED\xA0\x80", strings::UtfError::Surrogate, 1);
+    check("\xF4\x90\x80\x80", strings::UtfError::OutOfRange, 0);
+    check("\xFF", strings::UtfError::InvalidSequence, 0);
+
+    REQUIRE_THROWS_AS(strings::toWide(std::string("\xFF")), std::range_error);
+    REQUIRE_THROWS_AS(strings::fromWide(std::wstring(1, static_cast<wchar_t>(0xD800))), std::range_error);
+    REQUIRE_THROWS_AS(strings::fromWide(std::wstring(1, static_cast<wchar_t>(0x110000))), std::range_error);
+}
+
+TEST_CASE("Can validate UTF-8", "[Strings]") {
+    const std::string text = "Grüße aus Köln, 日本語のテキスト, 😀 and some ASCII. The quick brown fox jumps over the lazy dog.";
+
+    REQUIRE(strings::isValidUtf8(""));
+    REQUIRE(strings::isValidUtf8(text));
+    REQUIRE(strings::validateUtf8(text).position == text.size());
+
+    // Errors are found in the ASCII blocks as well as in the tail, at the same position as toWide finds them.
+    std::array<wchar_t, 256> buffer{};
+    for (const std::string_view invalid : {"\x80", "\xC3", "\xC0\xAF", "\xED\xA0\x80", "\xF4\x90\x80\x80", "\xFF"}) {
+        for (const std::size_t at : {std::size_t{0}, std::size_t{17}, text.size() - 3, text.size()}) {
+            auto str = text;
+            str.insert(strings::ceilCodePointBoundary(str, at), invalid);
+
+            const auto result = strings::validateUtf8(str);
+            const auto expected = strings::toWide(str, buffer);
+            REQUIRE_FALSE(result);
+            REQUIRE(result.error == expected.error);
+            REQUIRE(result.position == expected.read);
+        }
+    }
+}
+
+TEST_CASE("Can count code points and find boundaries", "[Strings]") {
+    const std::string text = "Grüße aus Köln, 日本語のテキスト, 😀 and some ASCII. The quick brown fox jumps over the lazy dog.";
+    const auto wide = strings::toWide(text);
+
+    REQUIRE(strings::countCodePoints("") == 0);
+    REQUIRE(strings::countCodePoints(text) == wide.size());
+
+    // "ü" takes the bytes 2 and 3.
+    REQUIRE(strings::floorCodePointBoundary(text, 3) == 2);
+    REQUIRE(strings::ceilCodePointBoundary(text, 3) == 4);
+    REQUIRE(strings::floorCodePointBoundary(text, 2) == 2);
+    REQUIRE(strings::floorCodePointBoundary(text, text.size() + 5) == text.size());
+    REQUIRE(strings::ceilCodePointBoundary(text, text.size() + 5) == text.size());
+
+    const auto emoji = text.find("😀");
+    for (std::size_t k = 0; k < 4; ++k) {
+        REQUIRE(strings::floorCodePointBoundary(text, emoji + k) == emoji);
+        REQUIRE(strings::ceilCodePointBoundary(text, emoji + k) == (k == 0 ? emoji : emoji + 4));
+    }
+
+    for (std::size_t i = 0; i < wide.size(); ++i) {
+        const auto offset = strings::getCodePointOffset(text, i);
+        REQUIRE(strings::countCodePoints(std::string_view(text).substr(0, offset)) == i);
+    }
+    REQUIRE(strings::getCodePointOffset(text, wide.size()) == text.size());
+}
+
+TEST_CASE("Can convert the case of strings", "[Strings]") {
+    const std::string ascii = "The Quick Brown Fox Jumps Over The Lazy Dog, 0123456789 [@`{~]";
+    REQUIRE(strings::toUppercase(ascii) == "THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG, 0123456789 [@`{~]");
+    REQUIRE(strings::toLowercase(ascii) == "the quick brown fox jumps over the lazy dog, 0123456789 [@`{~]");
+    REQUIRE(strings::toUppercase("").empty());
+
+    // Every length, so both the blocks and the tail are covered.
+    for (std::size_t n = 0; n <= ascii.size(); ++n) {
+        auto str = ascii.substr(0, n);
+        auto expected = str;
+        std::ranges::transform(expected, expected.begin(), [](char c) { return static_cast<char>(std::toupper(c)); });
+
+        std::string out(n, '\0');
+        strings::toUppercase(str, out);
+        REQUIRE(out == expected);
+        strings::toUppercaseInPlace(str);
+        REQUIRE(str == expected);
+    }
+
+    // Non-ASCII characters never change the length, invalid sequences are kept.
+    const std::string mixed = "Grüße aus Köln, 日本語, \xFF 😀 and some more ASCII text";
+    const auto upper = strings::toUppercase(mixed);
+    REQUIRE(upper.size() == mixed.size());
+    REQUIRE(upper.ends_with("\xFF 😀 AND SOME MORE ASCII TEXT"));
+    REQUIRE(strings::toLowercase(upper).ends_with("\xFF 😀 and some more ascii text"));
+}
+
+TEST_CASE("Can compare and hash strings ignoring case", "[Strings]") {
+    REQUIRE(strings::equalsIgnoreCase("Hello, World", "hELLO, wORLD"));
+    REQUIRE_FALSE(strings::equalsIgnoreCase("Hello", "Hello!"));
+    REQUIRE_FALSE(strings::equalsIgnoreCase("Hello[", "hello{"));
+    REQUIRE(strings::compareIgnoreCase("apple", "BANANA") < 0);
+    REQUIRE(strings::compareIgnoreCase("Banana", "apple") > 0);
+    REQUIRE(strings::compareIgnoreCase("Apple", "apple pie") < 0);
+    REQUIRE(strings::compareIgnoreCase("", "") == 0);
+
+    // Longer than a chunk, so chunks are compared and hashed.
+    std::string a;
+    while (a.size() < 1000) {
+        a += "Some Mixed Case Text with Grüße ";
+    }
+    const auto b = strings::toUppercase(a);
+    REQUIRE(strings::equalsIgnoreCase(a, b));
+    REQUIRE(strings::hashIgnoreCase(a) == strings::hashIgnoreCase(b));
+    REQUIRE(strings::compareIgnoreCase(a, b + "x") < 0);
+    REQUIRE(strings::hashIgnoreCase(a) != strings::hashIgnoreCase(a + "x"));
+
+    std::unordered_map<std::string, int, strings::CaseInsensitiveHash, strings::CaseInsensitiveEqual> map;
+    map["Content-Type"] = 1;
+    REQUIRE(map.find(std::string_view("content-type")) != map.end());
+    REQUIRE(map.count("CONTENT-TYPE") == 1);
+
+    std::set<std::string, strings::CaseInsensitiveLess> set{"b", "A", "c"};
+    REQUIRE(std::vector<std::string>(set.begin(), set.end()) == std::vector<std::string>{"A", "b", "c"});
+}
+
+TEST_CASE("Non-ASCII characters are converted with the locale", "[Strings]") {
+    const auto *previous = std::setlocale(LC_CTYPE, nullptr);
+    const std::string saved = previous != nullptr ? previous : "C";
+    // The checks need a UTF-8 locale, which not every system has.
+    if (std::setlocale(LC_CTYPE, "C.UTF-8") != nullptr) {
+        REQUIRE(strings::toUppercase("grüße, ÉTÉ, привет") == "GRÜßE, ÉTÉ, ПРИВЕТ");
+        REQUIRE(strings::toLowercase("GRÜSSE, ÉTÉ, ПРИВЕТ") == "grüsse, été, привет");
+    }
+
+    std::setlocale(LC_CTYPE, saved.c_str());
+}
+
+TEST_CASE("Comparing ignoring case does not depend on the locale", "[Strings]") {
+    const auto *previous = std::setlocale(LC_CTYPE, nullptr);
+    const std::string saved = previous != nullptr ? previous : "C";
+
+    std::unordered_map<std::string, int, strings::CaseInsensitiveHash, strings::CaseInsensitiveEqual> map;
+    std::setlocale(LC_CTYPE, "C");
+    map["Köln"] = 1;
+    map["ΑΘΉΝΑ"] = 2;
+    map["Ĳssel Łódź Ӂ Ǆ"] = 3;
+    const auto hash = strings::hashIgnoreCase("KÖLN");
+
+    for (const auto *locale : {"C", "C.UTF-8"}) {
+        if (std::setlocale(LC_CTYPE, locale) == nullptr) {
+            continue;
+        }
+        REQUIRE(strings::hashIgnoreCase("KÖLN") == hash);
+        REQUIRE(strings::equalsIgnoreCase("Grüße, ПРИВЕТ, Ἀ, ＡＢＣ", "GRÜßE, привет, Ἀ, ａｂｃ"));
+        REQUIRE(strings::equalsIgnoreCase("ΣΊΣΥΦΟΣ", "σίσυφος"));
+        REQUIRE(map.at("KÖLN") == 1);
+        REQUIRE(map.at("αθήνα") == 2);
+        REQUIRE(map.at("ĳssel łódź ӂ Ǆ") == 3);
+    }
+
+    std::setlocale(LC_CTYPE, saved.c_str());
+}
+
+TEST_CASE("Can convert case styles", "[Strings]") {
+    REQUIRE(strings::toSnakeCase("Hello World-foo_Bar") == "hello_world_foo_bar");
+    REQUIRE(strings::toKebabCase("  Hello \t World__foo ") == "hello-world-foo");
+    REQUIRE(strings::toCamelCase("hello world-foo_bar") == "helloWorldFooBar");
+    REQUIRE(strings::toCamelCase("hello world", true) == "HelloWorld");
+    REQUIRE(strings::toCamelCase("x y z") == "xYZ");
+    REQUIRE(strings::toSnakeCase("").empty());
+    REQUIRE(strings::toCamelCase("  ").empty());
+    REQUIRE(strings::toSnakeCase("trailing_ ") == "trailing");
+
+    // Into a buffer or any output iterator.
+    const std::string_view str = "Some Identifier name";
+    std::array<char, 32> buffer{};
+    const auto *end = strings::toSnakeCase(str, buffer.data());
+    REQUIRE(std::string_view(buffer.data(), end) == "some_identifier_name");
+
+    std::string out;
+    strings::toCamelCase(str, std::back_inserter(out), true);
+    REQUIRE(out == "SomeIdentifierName");
+
+    // The same words as tokenize finds.
+    for (const std::string s : {"a_", "_a", "a\n_\nb", "a - - b", "-", "a\tb c", "A-B_C D"}) {
+        const auto tokens = strings::tokenize(s, std::vector<std::string>{" ", "\t", "-", "_"});
+        REQUIRE(strings::toSnakeCase(s) == strings::toLowercase(strings::join("_", tokens)));
+    }
+}
+
+TEST_CASE("Can join ranges", "[Strings]") {
+    const std::vector<std::string> strings = {"a", "bc", "", "d"};
+    REQUIRE(strings::join(", ", strings) == "a, bc, , d");
+    REQUIRE(strings::join(std::string("-"), std::vector<std::string>{}).empty());
+    REQUIRE(strings::join(L"/", std::vector<std::wstring>{L"x", L"y"}) == L"x/y");
+    REQUIRE(strings::join("", std::vector<std::string_view>{"ab", "cd"}) == "abcd");
+
+    // Numbers, characters and booleans format like they stream.
+    REQUIRE(strings::join(",", std::vector<int>{1, -2, 30}) == "1,-2,30");
+    REQUIRE(strings::join(",", std::vector<double>{0.5, 0.1, -3}) == "0.5,0.1,-3");
+    REQUIRE(strings::join(L" ", std::vector<long>{42, 7}) == L"42 7");
+    REQUIRE(strings::join("", std::vector<char>{'o', 'k'}) == "ok");
+    REQUIRE(strings::join(" ", std::vector<bool>{true, false}) == "1 0");
+    REQUIRE(strings::implode<double>(",", {1.0 / 3, 123456789.0}) == "0.333333,1.23457e+08");
+    REQUIRE(strings::implode<uint8>(",", {'A', 'B'}) == "A,B");
+    REQUIRE(strings::implode<uint8>(L",", {'A', 'B'}) == L"65,66");
+
+    // Any range, including views that can only be iterated once.
+    REQUIRE(strings::join("+", std::views::iota(1, 5)) == "1+2+3+4");
+    REQUIRE(strings::join(" ", strings | std::views::filter([](const auto &s) { return !s.empty(); })) == "a bc d");
+
+    std::string out = "values: ";
+    strings::joinInto(out, "; ", std::array{1.5, 2.5});
+    REQUIRE(out == "values: 1.5; 2.5");
+
+    REQUIRE(strings::implode<std::string>("_", strings) == "a_bc__d");
+    REQUIRE(strings::implode<int>(", ", std::vector<int>{1, 2}) == "1, 2");
+    REQUIRE(strings::implode<std::wstring>(L"_", std::vector<std::wstring>{L"a", L"b"}) == L"a_b");
+}
+
+TEST_CASE("Can intern symbols", "[Strings]") {
+    strings::SymbolTable table;
+    REQUIRE(table.size() == 1);
+    REQUIRE(table.intern("") == strings::Symbol());
+    REQUIRE(strings::Symbol().id() == 0);
+    REQUIRE(strings::Symbol().empty());
+
+    const auto a = table.intern("eni.logging");
+    const auto b = table.intern(std::string("eni.") + "logging");
+    REQUIRE(a == b);
+    REQUIRE(a.id() == 1);
+    REQUIRE(a.view() == "eni.logging");
+    REQUIRE(a.view().data() == b.view().data());
+    REQUIRE(table.intern("eni.varying") != a);
+    REQUIRE(table.size() == 3);
+
+    REQUIRE(table.find("eni.logging") == a);
+    REQUIRE_FALSE(table.find("eni.unknown"));
+    REQUIRE(table.get(a.id()) == a);
+    REQUIRE(table.get(0) == strings::Symbol());
+
+    // Enough symbols to grow the index and fill several segments, and a string longer than a block.
+    std::vector<strings::Symbol> symbols;
+    for (int i = 0; i < 5000; ++i) {
+        symbols.push_back(table.intern("symbol" + std::to_string(i)));
+    }
+    const auto longSymbol = table.intern(std::string(20000, 'x'));
+    for (int i = 0; i < 5000; ++i) {
+        REQUIRE(table.intern("symbol" + std::to_string(i)) == symbols[i]);
+        REQUIRE(table.get(symbols[i].id()).view() == "symbol" + std::to_string(i));
+    }
+    REQUIRE(longSymbol.view() == std::string(20000, 'x'));
+    REQUIRE(table.find("eni.logging") == a);
+    REQUIRE(table.size() == 5004);
+    REQUIRE(std::hash<strings::Symbol>{}(a) == std::hash<strings::Symbol>{}(b));
+}
+
+TEST_CASE("Symbols can be interned concurrently", "[Strings]") {
+    strings::SymbolTable table;
+    constexpr int threadCount = 4;
+    constexpr int symbolCount = 20000;
+
+    std::vector<std::vector<strings::Symbol>> results(threadCount);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; ++t) {
+        threads.emplace_back([&table, &results, t] {
+            for (int i = 0; i < symbolCount; ++i) {
+                results[t].push_back(table.intern("key" + std::to_string((i * (t + 1)) % symbolCount)));
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    REQUIRE(table.size() == symbolCount + 1);
+    for (int t = 0; t < threadCount; ++t) {
+        for (int i = 0; i < symbolCount; ++i) {
+            const auto key = "key" + std::to_string((i * (t + 1)) % symbolCount);
+            REQUIRE(results[t][i] == table.find(key));
+            REQUIRE(results[t][i].view() == key);
+        }
+    }
+}
+
+TEST_CASE("Streaming tokenization matches tokenize", "[Strings]") {
+    const std::vector<std::vector<std::string>> separatorSets = {
+            {","},
+            {" ", "\t", "-", "_"},
+            {"ab", "a", "bc"},
+            {"::", ":", "->", " "},
+            {"a", "b", "c", "d", "e", "f", "g", "h", "i", "j"},
+    };
+
+    std::mt19937 random(42);
+    for (const auto &separators : separatorSets) {
+        for (int n = 0; n < 50; ++n) {
+            std::string str;
+            const auto length = random() % 200;
+            for (std::size_t i = 0; i < length; ++i) {
+                str += " \tab,c:-_>xyz"[random() % 13];
+            }
+
+            for (const auto options : {strings::TokenizeOptions{}, strings::TokenizeOptions{false, false, true}, strings::TokenizeOptions{true, false, false}}) {
+                const auto expected = strings::tokenize(str, separators, options.trim, options.skipEmpty, options.keepSeparators);
+
+                // Chunks of every size from 1 on, and random chunks.
+                for (std::size_t chunkSize = 1; chunkSize <= 9; ++chunkSize) {
+                    strings::TokenStream stream(separators, options);
+                    std::vector<std::string> tokens;
+                    auto collect = [&tokens](std::string_view token) { tokens.emplace_back(token); };
+                    for (std::size_t i = 0; i < str.size(); i += chunkSize) {
+                        stream.feed(std::string_view(str).substr(i, chunkSize), collect);
+                    }
+                    stream.finish(collect);
+                    REQUIRE(tokens == expected);
+                }
+
+                strings::TokenStream stream(separators, options);
+                std::vector<std::string> tokens;
+                auto collect = [&tokens](std::string_view token) { tokens.emplace_back(token); };
+                for (std::size_t i = 0; i < str.size();) {
+                    const auto chunkSize = random() % 40;
+                    stream.feed(std::string_view(str).substr(i, chunkSize), collect);
+                    i += chunkSize;
+                }
+                stream.finish(collect);
+                REQUIRE(tokens == expected);
+            }
+        }
+    }
+}
+
+TEST_CASE("Can tokenize streams and files", "[Strings]") {
+    std::string str;
+    for (int i = 0; i < 300000; ++i) {
+        str += "token" + std::to_string(i) + (i % 7 == 0 ? " ;\n" : ";");
+    }
+    const auto expected = strings::tokenize(str, std::vector<std::string>{";"});
+
+    strings::TokenStream stream({";"});
+    std::vector<std::string> tokens;
+    auto collect = [&tokens](std::string_view token) { tokens.emplace_back(token); };
+
+    std::istringstream is(str);
+    stream.read(is, collect);
+    REQUIRE(tokens == expected);
+
+    const auto path = std::filesystem::temp_directory_path() / "eni_token_stream_test.txt";
+    {
+        std::ofstream os(path, std::ios::binary);
+        os << str;
+    }
+    tokens.clear();
+    stream.readFile(path, collect);
+    std::filesystem::remove(path);
+    REQUIRE(tokens == expected);
+
+    REQUIRE_THROWS_AS(stream.readFile(path, collect), IOException);
+}
+
+TEST_CASE("Parallel splitting matches tokenize", "[Strings]") {
+    const std::vector<std::vector<std::string>> separatorSets = {
+            {"\n"},
+            {" ", ","},
+            {"ab", "a", "bab"},
+            {"a", "b", "c", "d", "e", "f", "g", "h", "i", "j"},
+    };
+
+    std::mt19937 random(7);
+    for (const auto &separators : separatorSets) {
+        // Long runs of overlapping matches reach across partition boundaries.
+        std::string str;
+        while (str.size() < 512 * 1024) {
+            const auto run = random() % 64;
+            for (std::size_t i = 0; i < run; ++i) {
+                str += " \n,ababx"[random() % 8];
+            }
+            str += random() % 2 == 0 ? std::string(random() % 200, 'b') : std::string(random() % 200, 'a');
+        }
+
+        for (const auto options : {strings::TokenizeOptions{}, strings::TokenizeOptions{false, false, true}, strings::TokenizeOptions{true, false, false}}) {
+            const auto expected = strings::tokenize(str, separators, options.trim, options.skipEmpty, options.keepSeparators);
+            for (const std::size_t threads : {1, 3, 8}) {
+                const auto tokens = strings::splitParallel(str, separators, options, threads);
+                REQUIRE(std::vector<std::string>(tokens.begin(), tokens.end()) == expected);
+            }
+        }
+    }
+
+    // Separators reaching across partition boundaries, with the same separators taken after them or none at all.
+    std::string repeated;
+    while (repeated.size() < 600000) {
+        repeated += "xab";
+    }
+    for (const auto &[str, separators] : {std::pair{repeated, std::vector<std::string>{"ab", "b"}},
+                                          std::pair{std::string(600003, 'a'), std::vector<std::string>{"aa"}}}) {
+        const auto expected = strings::tokenize(str, separators, true, false, true);
+        for (std::size_t threads = 2; threads <= 8; ++threads) {
+            const auto tokens = strings::splitParallel(str, separators, {true, false, true}, threads);
+            REQUIRE(std::vector<std::string>(tokens.begin(), tokens.end()) == expected);
+        }
+    }
+
+    // Leading empty tokens and a remainder that trims to nothing.
+    const std::string sparse = std::string(300000, ',') + "x, " + std::string(300000, ',') + " ";
+    const auto expected = strings::tokenize(sparse, std::vector<std::string>{","}, true, false);
+    const auto tokens = strings::splitParallel(sparse, std::vector<std::string>{","}, {true, false, false}, 4);
+    REQUIRE(std::vector<std::string>(tokens.begin(), tokens.end()) == expected);
+}
+
+TEST_CASE("Can tokenize into a token table", "[Strings]") {
+    strings::TokenTable table;
+    REQUIRE(table.empty());
+
+    strings::tokenizeInto(table, "a, bc,,d ", ",");
+    REQUIRE(table.size() == 3);
+    REQUIRE(table[0] == "a");
+    REQUIRE(table[1] == "bc");
+    REQUIRE(table[2] == "d");
+    REQUIRE(table.bytes() == "abcd");
+    REQUIRE(std::vector<std::size_t>(table.offsets().begin(), table.offsets().end()) == std::vector<std::size_t>{0, 1, 3, 4});
+    REQUIRE(table.toVector() == std::vector<std::string>{"a", "bc", "d"});
+    REQUIRE(std::ranges::equal(table, std::vector<std::string_view>{"a", "bc", "d"}));
+    REQUIRE(table.end() - table.begin() == 3);
+
+    const std::vector<std::string> separators = {"::", ":", "->", " "};
+    std::mt19937 random(3);
+    for (int n = 0; n < 200; ++n) {
+        std::string str;
+        const auto length = random() % 100;
+        for (std::size_t i = 0; i < length; ++i) {
+            str += " :->ab"[random() % 6];
+        }
+        for (const auto options : {strings::TokenizeOptions{}, strings::TokenizeOptions{false, false, true}}) {
+            strings::tokenizeInto(table, str, separators, options);
+            REQUIRE(table.toVector() == strings::tokenize(str, separators, options.trim, options.skipEmpty, options.keepSeparators));
+        }
+    }
+
+    // Once warmed up, tokenizing again reuses the memory of the table.
+    const std::string str = "some words, separated by spaces and commas, over and over";
+    strings::tokenizeInto(table, str, separators);
+    const auto *bytes = table.bytes().data();
+    const auto *offsets = table.offsets().data();
+    strings::tokenizeInto(table, str, separators);
+    REQUIRE(table.bytes().data() == bytes);
+    REQUIRE(table.offsets().data() == offsets);
+}
+
+TEST_CASE("Can trim strings", "[Strings]") {
+    REQUIRE(strings::trimmed("  a b\t\r\n") == "a b");
+    REQUIRE(strings::trimmed(L"\ta b ") == L"a b");
+    REQUIRE(strings::trimmedLeft("  a ") == "a ");
+    REQUIRE(strings::trimmedRight("  a ") == "  a");
+    REQUIRE(strings::trimmed(" \t ").empty());
+    REQUIRE(strings::trimmed("").empty());
+    REQUIRE(strings::trimmed("xxaxx", "x") == "a");
+    REQUIRE(strings::trimmed("xx", "x").empty());
+    static_assert(strings::trimmed(std::string_view(" a ")) == "a");
+
+    std::string str = "\t a b \n";
+    strings::trim(str);
+    REQUIRE(str == "a b");
+    str = "--a-";
+    strings::trim(str, "-");
+    REQUIRE(str == "a");
+    str = "   ";
+    strings::trim(str);
+    REQUIRE(str.empty());
+    std::wstring wide = L" a ";
+    strings::trim(wide);
+    REQUIRE(wide == L"a");
+    wide = L" \t ";
+    strings::trim(wide);
+    REQUIRE(wide.empty());
+
+    // Long whitespace runs are classified a block at a time, compare them with a plain scan across block boundaries.
+    const auto reference = [](std::string_view s) {
+        const auto from = s.find_first_not_of(" \t\n\r");
+        return from == std::string_view::npos ? std::string_view() : s.substr(from, s.find_last_not_of(" \t\n\r") - from + 1);
+    };
+    std::mt19937 random(5);
+    for (int n = 0; n < 2000; ++n) {
+        std::string input;
+        const auto length = random() % 80;
+        for (std::size_t i = 0; i < length; ++i) {
+            input += random() % 8 == 0 ? "ab\v"[random() % 3] : " \t\n\r"[random() % 4];
+        }
+        REQUIRE(strings::trimmed(input) == reference(input));
+        REQUIRE(strings::toWide(std::string(strings::trimmed(input))) == strings::trimmed(strings::toWide(input)));
+    }
+}
+
+TEST_CASE("Benchmark tokenize", "[.][benchmark][Strings]") {
+    std::string input;
+    while (input.size() < 4 * 1024 * 1024) {
+        input += "key = välue; other=\"42\";  ümlaut → text;\n";
+    }
+    const std::vector<std::string> separators = {";", "=", "\n"};
+
+    BENCHMARK("Wide round-trip") {
+        std::vector<std::wstring> wideSeparators;
+        for (const auto &separator : separators) {
+            wideSeparators.push_back(strings::toWide(separator));
+        }
+
+        std::vector<std::string> tokens;
+        for (const auto &token : strings::tokenize(strings::toWide(input), wideSeparators)) {
+            tokens.push_back(strings::fromWide(token));
+        }
+        return tokens.size();
+    };
+
+    BENCHMARK("UTF-8") {
+        return strings::tokenize(input, separators).size();
+    };
+
+    BENCHMARK("split_view") {
+        return std::ranges::distance(strings::split_view(input, separators));
+    };
+}
+
+TEST_CASE("Benchmark separator search", "[.][benchmark][Strings]") {
+    std::string input;
+    while (input.size() < 1024 * 1024) {
+        input += "The quick brown fox jumps over the lazy dog, while 42 cats watch; ";
+    }
+
+    const std::vector<std::string> all = {";", ",", "!", "?", ":", "|", "#", "@", "$", "%", "&", "*",
+                                          "lazy", "quick", "cats", "over", "the", "dog", "fox", "42",
+                                          "A", "B", "C", "D", "E", "F", "G", "H", "I", "J", "K", "L"};
+
+    for (const std::size_t count : {1, 4, 8, 16, 32}) {
+        const std::span<const std::string> separators(all.data(), count);
+
+        BENCHMARK("Naive, " + std::to_string(count) + " separators") {
+            std::size_t matches = 0;
+            for (std::size_t n = 0; n < input.size();) {
+                bool found = false;
+                for (const auto &separator : separators) {
+                    if (n + separator.size() < input.size() && input.compare(n, separator.size(), separator) == 0) {
+                        n += separator.size();
+                        matches++;
+                        found = true;
+                        break;
+                    }
+                }
+                if (!found) {
+                    n++;
+                }
+            }
+            return matches;
+        };
+
+        BENCHMARK("separator_search, " + std::to_string(count) + " separators") {
+            const strings::basic_separator_search<char, std::string> search(separators);
+            std::size_t matches = 0;
+            for (auto match = search.find(input, 0, separators); match.position != std::string::npos;
+                 match = search.find(input, match.position + match.length, separators)) {
+                matches++;
+            }
+            return matches;
+        };
+    }
+}
+
+TEST_CASE("Benchmark case conversion", "[.][benchmark][Strings]") {
+    std::string ascii;
+    std::string mixed;
+    while (ascii.size() < 4 * 1024 * 1024) {
+        ascii += "The Quick Brown Fox Jumps Over The Lazy Dog. ";
+        mixed += "Grüße aus Köln, 日本語のテキスト, 😀 and some ASCII. ";
+    }
+    const auto upper = strings::toUppercase(ascii);
+
+    BENCHMARK("std::toupper, ASCII") {
+        auto result = ascii;
+        std::ranges::transform(result, result.begin(), ::toupper);
+        return result.size();
+    };
+    BENCHMARK("toUppercase, ASCII") { return strings::toUppercase(ascii).size(); };
+    BENCHMARK("toUppercase, mixed") { return strings::toUppercase(mixed).size(); };
+    BENCHMARK("Lowercase copies equal") { return strings::toLowercase(ascii) == strings::toLowercase(upper); };
+    BENCHMARK("equalsIgnoreCase") { return strings::equalsIgnoreCase(ascii, upper); };
+    BENCHMARK("hashIgnoreCase") { return strings::hashIgnoreCase(ascii); };
+}
+
+TEST_CASE("Benchmark case styles", "[.][benchmark][Strings]") {
+    std::vector<std::string> identifiers;
+    for (int i = 0; i < 10000; ++i) {
+        identifiers.push_back("some mixed-Case identifier_" + std::to_string(i));
+    }
+
+    // The previous implementation, through tokenize, implode and a transform.
+    auto tokenizeSnakeCase = [](const std::string &str) {
+        const auto tokens = strings::tokenize(str, std::vector<std::string>({" ", "\t", "-", "_"}), true, true, false);
+        auto s = strings::implode<std::string>("_", tokens);
+        std::ranges::transform(s, s.begin(), ::tolower);
+        return s;
+    };
+
+    BENCHMARK("tokenize + implode") {
+        std::size_t size = 0;
+        for (const auto &identifier : identifiers) {
+            size += tokenizeSnakeCase(identifier).size();
+        }
+        return size;
+    };
+    BENCHMARK("toSnakeCase") {
+        std::size_t size = 0;
+        for (const auto &identifier : identifiers) {
+            size += strings::toSnakeCase(identifier).size();
+        }
+        return size;
+    };
+    BENCHMARK("toSnakeCase, into a buffer") {
+        std::array<char, 64> buffer{};
+        std::size_t size = 0;
+        for (const auto &identifier : identifiers) {
+            size += static_cast<std::size_t>(strings::toSnakeCase(identifier, buffer.data()) - buffer.data());
+        }
+        return size;
+    };
+}
+
+TEST_CASE("Benchmark join", "[.][benchmark][Strings]") {
+    std::vector<std::string> strings;
+    std::vector<int> numbers;
+    for (int i = 0; i < 100000; ++i) {
+        strings.push_back("element" + std::to_string(i));
+        numbers.push_back(i * 7919);
+    }
+
+    auto streamImplode = [](const auto &container) {
+        std::stringstream ss;
+        bool first = true;
+        for (const auto &element : container) {
+            if (!first) {
+                ss << ", ";
+            }
+            first = false;
+            ss << element;
+        }
+        return ss.str();
+    };
+
+    auto appendJoin = [&strings] {
+        std::string result;
+        bool first = true;
+        for (const auto &element : strings) {
+            if (!first) {
+                result += ", ";
+            }
+            first = false;
+            result += element;
+        }
+        return result;
+    };
+
+    BENCHMARK("stringstream, strings") { return streamImplode(strings).size(); };
+    BENCHMARK("Appending, strings") { return appendJoin().size(); };
+    BENCHMARK("join, strings") { return strings::join(", ", strings).size(); };
+    BENCHMARK("stringstream, numbers") { return streamImplode(numbers).size(); };
+    BENCHMARK("join, numbers") { return strings::join(", ", numbers).size(); };
+}
+
+TEST_CASE("Benchmark symbol lookup", "[.][benchmark][Strings]") {
+    std::vector<std::string> keys;
+    for (int i = 0; i < 10000; ++i) {
+        keys.push_back("eni.module" + std::to_string(i) + ".logger");
+    }
+
+    strings::SymbolTable table;
+    std::unordered_set<std::string> set;
+    std::shared_mutex mutex;
+    for (const auto &key : keys) {
+        table.intern(key);
+        set.insert(key);
+    }
+
+    BENCHMARK("unordered_set + shared_mutex") {
+        std::size_t found = 0;
+        for (const auto &key : keys) {
+            auto lk = std::shared_lock(mutex);
+            found += set.count(key);
+        }
+        return found;
+    };
+    BENCHMARK("SymbolTable::intern") {
+        std::size_t found = 0;
+        for (const auto &key : keys) {
+            found += table.intern(key).id();
+        }
+        return found;
+    };
+
+    const auto a = table.intern(keys[0]);
+    const auto b = table.intern(keys[0]);
+    std::string copy = keys[0];
+    BENCHMARK("string compare") { return copy == keys[0]; };
+    BENCHMARK("Symbol compare") { return a == b; };
+}
+
+TEST_CASE("Benchmark streaming tokenization", "[.][benchmark][Strings]") {
+    const auto path = std::filesystem::temp_directory_path() / "eni_token_stream_benchmark.txt";
+    {
+        std::ofstream os(path, std::ios::binary);
+        for (int i = 0; i < 500000; ++i) {
+            os << "2026-10-18 INFO module" << i % 100 << " message " << i << "\n";
+        }
+    }
+    const std::vector<std::string> separators = {"\n", " "};
+
+    BENCHMARK("Read into a string + tokenize") {
+        std::ifstream is(path, std::ios::binary);
+        const std::string str((std::istreambuf_iterator<char>(is)), std::istreambuf_iterator<char>());
+        return strings::tokenize(str, separators).size();
+    };
+    BENCHMARK("TokenStream::read") {
+        std::ifstream is(path, std::ios::binary);
+        std::size_t count = 0;
+        strings::TokenStream(separators).read(is, [&count](std::string_view) { count++; });
+        return count;
+    };
+    BENCHMARK("TokenStream::readFile") {
+        std::size_t count = 0;
+        strings::TokenStream(separators).readFile(path, [&count](std::string_view) { count++; });
+        return count;
+    };
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Benchmark parallel splitting", "[.][benchmark][Strings]") {
+    std::string str;
+    for (int i = 0; i < 2000000; ++i) {
+        str += "2026-10-18 INFO module" + std::to_string(i % 100) + " message " + std::to_string(i) + "\n";
+    }
+    const std::vector<std::string> separators = {"\n", " "};
+
+    BENCHMARK("split_view") {
+        std::size_t count = 0;
+        for ([[maybe_unused]] const auto token : strings::split_view(str, std::span<const std::string>(separators))) {
+            count++;
+        }
+        return count;
+    };
+    for (const std::size_t threads : {1, 2, 4, 8}) {
+        BENCHMARK("splitParallel, " + std::to_string(threads) + " threads") {
+            return strings::splitParallel(str, separators, {}, threads).size();
+        };
+    }
+}
+
+TEST_CASE("Benchmark token table", "[.][benchmark][Strings]") {
+    std::string str;
+    for (int i = 0; i < 100000; ++i) {
+        str += "key" + std::to_string(i % 10) + "=v, ";
+    }
+    const std::vector<std::string> separators = {",", "="};
+
+    BENCHMARK("tokenize") { return strings::tokenize(str, separators).size(); };
+
+    strings::TokenTable table;
+    BENCHMARK("tokenizeInto, new table") {
+        strings::TokenTable fresh;
+        strings::tokenizeInto(fresh, str, separators);
+        return fresh.size();
+    };
+    BENCHMARK("tokenizeInto, reused table") {
+        strings::tokenizeInto(table, str, separators);
+        return table.size();
+    };
+}
+
+TEST_CASE("Benchmark trim", "[.][benchmark][Strings]") {
+    std::vector<std::string> strings;
+    for (std::size_t i = 0; i < 10000; ++i) {
+        strings.push_back(std::string(i % 64, ' ') + "value" + std::string(i % 48, '\t'));
+    }
+
+    BENCHMARK("trim") {
+        std::size_t size = 0;
+        for (const auto &str : strings) {
+            auto copy = str;
+            strings::trim(copy);
+            size += copy.size();
+        }
+        return size;
+    };
+
+    BENCHMARK("trimmed") {
+        std::size_t size = 0;
+        for (const auto &str : strings) {
+            size += strings::trimmed(str).size();
+        }
+        return size;
+    };
+}
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+TEST_CASE("Benchmark transcoding", "[.][benchmark][Strings]") {
+    std::string ascii;
+    std::string mixed;
+    while (ascii.size() < 4 * 1024 * 1024) {
+        ascii += "The quick brown fox jumps over the lazy dog. ";
+        mixed += "Grüße aus Köln, 日本語のテキスト, 😀 and some ASCII. ";
+    }
+    const auto wideAscii = strings::toWide(ascii);
+    const auto wideMixed = strings::toWide(mixed);
+
+    auto codecvtToWide = [](const std::string &str) {
+        return std::wstring_convert<std::codecvt_utf8<wchar_t>>().from_bytes(str);
+    };
+    auto codecvtFromWide = [](const std::wstring &str) {
+        return std::wstring_convert<std::codecvt_utf8<wchar_t>>().to_bytes(str);
+    };
+
+    BENCHMARK("codecvt toWide, ASCII") { return codecvtToWide(ascii).size(); };
+    BENCHMARK("toWide, ASCII") { return strings::toWide(ascii).size(); };
+    BENCHMARK("codecvt toWide, mixed") { return codecvtToWide(mixed).size(); };
+    BENCHMARK("toWide, mixed") { return strings::toWide(mixed).size(); };
+    BENCHMARK("codecvt fromWide, ASCII") { return codecvtFromWide(wideAscii).size(); };
+    BENCHMARK("fromWide, ASCII") { return strings::fromWide(wideAscii).size(); };
+    BENCHMARK("codecvt fromWide, mixed") { return codecvtFromWide(wideMixed).size(); };
+    BENCHMARK("fromWide, mixed") { return strings::fromWide(wideMixed).size(); };
+
+    BENCHMARK("Validate with toWide, ASCII") {
+        try {
+            return strings::toWide(ascii).size();
+        } catch (const std::range_error &) {
+            return std::size_t{0};
+        }
+    };
+    BENCHMARK("validateUtf8, ASCII") { return strings::validateUtf8(ascii).position; };
+    BENCHMARK("validateUtf8, mixed") { return strings::validateUtf8(mixed).position; };
+    BENCHMARK("countCodePoints, mixed") { return strings::countCodePoints(mixed); };
+}
+#pragma GCC diagnostic pop
@@ -0,0 +1,51 @@
+//
+// Created by void on 10/18/26.
+//
+
+// Built together with eni/strings/utf8.cpp without SSE2, to cover the scalar paths used on targets such as Emscripten.
+
+#include <catch2/catch_all.hpp>
+
+#include <eni/strings/utf8.h>
+
+#include <array>
+#include <string>
+#include <string_view>
+
+using namespace eni;
+
+TEST_CASE("Can validate UTF-8 without SIMD", "[Strings]") {
+    const std::string text = "Grüße aus Köln, 日本語のテキスト, 😀 and some ASCII. The quick brown fox jumps over the lazy dog.";
+
+    REQUIRE(strings::isValidUtf8(std::string(40, 'a')));
+    REQUIRE(strings::isValidUtf8(text));
+    REQUIRE(strings::validateUtf8(text).position == text.size());
+
+    std::array<wchar_t, 256> buffer{};
+    for (const std::string_view invalid : {"\x80", "\xC3", "\xC0\xAF", "\xED\xA0\x80", "\xF4\x90\x80\x80", "\xFF"}) {
+        for (const std::size_t at : {std::size_t{0}, std::size_t{9}, std::size_t{17}, text.size() - 3, text.size()}) {
+            auto str = text;
+            str.insert(strings::ceilCodePointBoundary(str, at), invalid);
+
+            const auto result = strings::validateUtf8(str);
+            const auto expected = strings::toWide(str, buffer);
+            REQUIRE_FALSE(result);
+            REQUIRE(result.error == expected.error);
+            REQUIRE(result.position == expected.read);
+        }
+    }
+}
+
+TEST_CASE("Can transcode and count UTF-8 without SIMD", "[Strings]") {
+    const std::string text = std::string(40, 'a') + "Grüße aus Köln, 日本語のテキスト, 😀" + std::string(20, 'z');
+
+    std::array<wchar_t, 256> wide{};
+    const auto decoded = strings::toWide(text, wide);
+    REQUIRE(decoded);
+    REQUIRE(strings::countCodePoints(text) == decoded.written);
+
+    std::array<char, 256> utf8{};
+    const auto encoded = strings::fromWide(std::span(wide.data(), decoded.written), utf8);
+    REQUIRE(encoded);
+    REQUIRE(std::string_view(utf8.data(), encoded.written) == text);
+}
@@ -0,0 +1,412 @@
+//
+// Created by void on 10/18/26.
+//
+
+#include <catch2/catch_all.hpp>
+
+#include <eni/Varying.h>
+#include <eni/VaryingCatalog.h>
+#include <eni/VaryingPool.h>
+#include <eni/VaryingRegistry.h>
+#include <eni/exception.h>
+
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <limits>
+#include <sstream>
+#include <unordered_set>
+
+using namespace eni;
+
+TEST_CASE("Can evaluate conditions", "[Varying]") {
+    VaryingVariables variables;
+    variables.set(L"quality", int64{3});
+    variables.set(L"scale", 1.5);
+    variables.set(L"platform", std::wstring(L"linux"));
+    variables.set(L"lowMemory", false);
+
+    REQUIRE(VaryingCondition(L"").evaluate(variables));
+    REQUIRE(VaryingCondition(L"quality >= 2 && (platform == 'linux' || !lowMemory)").evaluate(variables));
+    REQUIRE(VaryingCondition(L"quality * 2 + 1 == 7").evaluate(variables));
+    REQUIRE(VaryingCondition(L"scale > quality / 2").evaluate(variables));
+    REQUIRE(VaryingCondition(L"-quality < 0 and not lowMemory").evaluate(variables));
+    REQUIRE(VaryingCondition(L"platform != \"windows\"").evaluate(variables));
+    REQUIRE(VaryingCondition(L"undefined == null").evaluate(variables));
+    REQUIRE_FALSE(VaryingCondition(L"undefined").evaluate(variables));
+    REQUIRE_FALSE(VaryingCondition(L"quality == '3'").evaluate(variables));
+    REQUIRE_FALSE(VaryingCondition(L"quality / 0").evaluate(variables));
+}
+
+TEST_CASE("Integer overflow in conditions falls back to doubles", "[Varying]") {
+    VaryingVariables variables;
+    variables.set(L"min", std::numeric_limits<int64>::min());
+    variables.set(L"max", std::numeric_limits<int64>::max());
+
+    REQUIRE(VaryingCondition(L"min / -1").evaluateValue(variables) == VaryingValue(9223372036854775808.0));
+    REQUIRE(VaryingCondition(L"min % -1").evaluateValue(variables) == VaryingValue(int64{0}));
+    REQUIRE(VaryingCondition(L"-min").evaluateValue(variables) == VaryingValue(9223372036854775808.0));
+    REQUIRE(VaryingCondition(L"max + 1").evaluateValue(variables) == VaryingValue(9223372036854775808.0));
+    REQUIRE(VaryingCondition(L"min - 1").evaluateValue(variables) == VaryingValue(-9223372036854775808.0));
+    REQUIRE(VaryingCondition(L"max * 2 > max").evaluate(variables));
+    REQUIRE(VaryingCondition(L"max - 1 + 1 == max").evaluate(variables));
+    REQUIRE(VaryingCondition(L"-7 / -1 == 7 && 7 % -1 == 0").evaluate(variables));
+}
+
+TEST_CASE("Conditions short-circuit", "[Varying]") {
+    class CountingEnvironment : public VaryingEnvironment {
+    public:
+        VaryingValue get(std::wstring_view name) const override {
+            lookups++;
+            return name == L"yes";
+        }
+
+        mutable int lookups = 0;
+    };
+
+    CountingEnvironment environment;
+    REQUIRE(VaryingCondition(L"yes || no").evaluate(environment));
+    REQUIRE(environment.lookups == 1);
+
+    REQUIRE_FALSE(VaryingCondition(L"no && yes").evaluate(environment));
+    REQUIRE(environment.lookups == 2);
+
+    REQUIRE(VaryingCondition(L"no || yes && yes").evaluate(environment));
+}
+
+TEST_CASE("Malformed conditions are rejected", "[Varying]") {
+    REQUIRE_THROWS_AS(VaryingCondition(L"quality >="), ParseException);
+    REQUIRE_THROWS_AS(VaryingCondition(L"(quality"), ParseException);
+    REQUIRE_THROWS_AS(VaryingCondition(L"'unterminated"), ParseException);
+    REQUIRE_THROWS_AS(VaryingCondition(L"a = b"), ParseException);
+    REQUIRE_THROWS_AS(VaryingCondition(L"1.2.3 > 0"), ParseException);
+    REQUIRE_THROWS_AS(VaryingCondition(L"1e > 0"), ParseException);
+    REQUIRE_THROWS_AS(VaryingCondition(std::wstring(1000000, L'(')), ParseException);
+    REQUIRE_THROWS_AS(VaryingCondition(std::wstring(1000000, L'!') + L"x"), ParseException);
+    REQUIRE(VaryingCondition(std::wstring(100, L'(') + L"1" + std::wstring(100, L')')).evaluate(VaryingVariables()));
+}
+
+TEST_CASE("Compiled conditions are cached", "[Varying]") {
+    auto a = VaryingCondition::compile(L"x > 1");
+    auto b = VaryingCondition::compile(L"x > 1");
+    REQUIRE(a == b);
+    REQUIRE(a->getVariables() == std::vector<std::wstring>{L"x"});
+
+    VaryingVariables variables;
+    variables.set(L"x", int64{2});
+    REQUIRE(make_varying_long(L"x > 1", 0, 10).evaluateCondition(variables));
+}
+
+TEST_CASE("The condition cache keeps the most recently used conditions", "[Varying]") {
+    const auto first = VaryingCondition::compile(L"cached == 1");
+    const auto second = VaryingCondition::compile(L"cached == 2");
+    for (std::size_t n = 0; n < VaryingCondition::CacheCapacity - 1; ++n) {
+        VaryingCondition::compile(L"evicting == " + std::to_wstring(n));
+        // Keep the second condition recently used.
+        REQUIRE(VaryingCondition::compile(L"cached == 2") == second);
+    }
+
+    REQUIRE(VaryingCondition::compile(L"cached == 1") != first);
+    REQUIRE(VaryingCondition::compile(L"cached == 2") == second);
+    REQUIRE(first->getSource() == L"cached == 1");
+}
+
+TEST_CASE("Can match patterns", "[Varying]") {
+    REQUIRE(VaryingPattern(L".*").getKind() == VaryingPattern::Kind::Any);
+    REQUIRE(VaryingPattern(L".*").matches(L"anything"));
+    REQUIRE_FALSE(VaryingPattern(L".*").matches(L"two\nlines"));
+
+    REQUIRE(VaryingPattern(L"linux").getKind() == VaryingPattern::Kind::Literal);
+    REQUIRE(VaryingPattern(L"linux").matches(L"linux"));
+    REQUIRE_FALSE(VaryingPattern(L"linux").matches(L"linux2"));
+
+    VaryingPattern version(L"^\\d+(?:\\.\\d+){1,2}(-[a-z]+)?$");
+    REQUIRE(version.getKind() == VaryingPattern::Kind::Dfa);
+    REQUIRE(version.matches(L"1.2"));
+    REQUIRE(version.matches(L"10.20.30-beta"));
+    REQUIRE_FALSE(version.matches(L"1"));
+    REQUIRE_FALSE(version.matches(L"1.2.3.4"));
+    REQUIRE_FALSE(version.matches(L"1.2-"));
+
+    VaryingPattern choice(L"low|medium|high|[^a-z\\s]\\w*");
+    REQUIRE(choice.matches(L"medium"));
+    REQUIRE(choice.matches(L"X_1"));
+    REQUIRE(choice.matches(L"été") == std::regex_match(std::wstring(L"été"), std::wregex(L"low|medium|high|[^a-z\\s]\\w*")));
+    REQUIRE_FALSE(choice.matches(L"mediums"));
+    REQUIRE_FALSE(choice.matches(L""));
+}
+
+TEST_CASE("Unsupported patterns fall back to std::wregex", "[Varying]") {
+    VaryingPattern pattern(L"(a+)\\1");
+    REQUIRE(pattern.getKind() == VaryingPattern::Kind::Regex);
+    REQUIRE(pattern.matches(L"aaaa"));
+    REQUIRE_FALSE(pattern.matches(L"aaa"));
+
+    REQUIRE_THROWS_AS(VaryingPattern(L"(unbalanced"), ParseException);
+    REQUIRE_THROWS_AS(VaryingPattern(L"[z-a]"), ParseException);
+}
+
+TEST_CASE("Stacked quantifiers are rejected", "[Varying]") {
+    for (const auto *pattern : {L"a**", L"a+*", L"a{2}+", L"a??*", L"(a|b)*{2}"}) {
+        REQUIRE_THROWS_AS(VaryingPattern(pattern), ParseException);
+    }
+
+    REQUIRE(VaryingPattern(L"a*?b").matches(L"aab"));
+    REQUIRE(VaryingPattern(L"(a*)*b").matches(L"aab"));
+}
+
+TEST_CASE("Deeply nested patterns are rejected", "[Varying]") {
+    REQUIRE_THROWS_AS(VaryingPattern(std::wstring(1000000, L'(')), ParseException);
+    REQUIRE_THROWS_AS(VaryingPattern(std::wstring(100000, L'(') + L"a" + std::wstring(100000, L')')), ParseException);
+    REQUIRE_THROWS_AS(VaryingPattern(L"a" + std::wstring(100000, L'?')), ParseException);
+    REQUIRE_THROWS_AS(VaryingPattern(L"(?:(?:a?)?)" + std::wstring(1000, L'?')), ParseException);
+
+    const VaryingPattern nested(std::wstring(100, L'(') + L"a" + std::wstring(100, L')'));
+    REQUIRE(nested.matches(L"a"));
+    REQUIRE_FALSE(nested.matches(L"aa"));
+}
+
+TEST_CASE("The pattern cache keeps the most recently used patterns", "[Varying]") {
+    const auto first = VaryingPattern::compile(L"cached1");
+    for (std::size_t n = 0; n < VaryingPattern::CacheCapacity; ++n) {
+        VaryingPattern::compile(L"evicting" + std::to_wstring(n));
+    }
+
+    REQUIRE(VaryingPattern::compile(L"cached1") != first);
+    REQUIRE(first->matches(L"cached1"));
+}
+
+TEST_CASE("Can validate Varying strings", "[Varying]") {
+    REQUIRE(VaryingPattern::compile(L"[a-z]+") == VaryingPattern::compile(L"[a-z]+"));
+
+    auto varying = make_varying_string(L"", L"[a-z]{2,8}");
+    REQUIRE(varying.isValid(L"linux"));
+    REQUIRE_FALSE(varying.isValid(L"x"));
+    REQUIRE(make_varying_string(L"").isValid(L"whatever"));
+}
+
+TEST_CASE("Benchmark pattern matching", "[.][benchmark][Varying]") {
+    const std::wstring pattern = L"[A-Za-z_][A-Za-z0-9_]*(\\.[A-Za-z_][A-Za-z0-9_]*)*";
+    const std::wstring value = L"render.shadows.cascade_count.quality";
+
+    const VaryingPattern compiled(pattern);
+    const std::wregex regex(pattern, std::regex_constants::ECMAScript | std::regex_constants::optimize);
+
+    BENCHMARK("VaryingPattern") {
+        return compiled.matches(value);
+    };
+
+    BENCHMARK("std::wregex") {
+        return std::regex_match(value, regex);
+    };
+}
+
+TEST_CASE("Can validate and clamp numbers in bulk", "[Varying]") {
+    const auto varying = make_varying_long(L"", -10, 10, 0);
+
+    std::vector<int64> values(150);
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        values[i] = static_cast<int64>(i) - 20;
+    }
+
+    std::vector<uint64> violations((values.size() + 63) / 64);
+    REQUIRE(varying.validate(values, violations) == 10 + 119);
+
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        const bool violated = (violations[i / 64] >> (i % 64)) & 1;
+        REQUIRE(violated == (values[i] < -10 || values[i] > 10));
+    }
+    REQUIRE(varying.validate(std::span<const int64>(values)) == violations);
+
+    varying.clamp(values);
+    REQUIRE(values.front() == -10);
+    REQUIRE(values[25] == 5);
+    REQUIRE(values.back() == 10);
+    REQUIRE(varying.validate(values, violations) == 0);
+
+    const auto varyingFloat = make_varying_float(L"", 0.0, 1.0, 0.5);
+    std::vector<double> floats = {-1.0, 0.25, 2.0, std::numeric_limits<double>::quiet_NaN()};
+    REQUIRE(varyingFloat.validate(std::span<const double>(floats)) == std::vector<uint64>{0b1101});
+
+    varyingFloat.clamp(floats);
+    REQUIRE(floats == std::vector<double>{0.0, 0.25, 1.0, 0.5});
+}
+
+TEST_CASE("Benchmark bulk validation", "[.][benchmark][Varying]") {
+    const auto varying = make_varying_float(L"", -1.0, 1.0, 0.0);
+
+    std::vector<double> values(1 << 16);
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        values[i] = std::sin(static_cast<double>(i)) * 1.1;
+    }
+    std::vector<uint64> violations((values.size() + 63) / 64);
+
+    BENCHMARK("Scalar validation") {
+        std::size_t count = 0;
+        for (const auto value : values) {
+            if (!(value >= varying.minValue && value <= varying.maxValue)) {
+                count++;
+            }
+        }
+        return count;
+    };
+
+    BENCHMARK("Batch validation") {
+        return varying.validate(values, violations);
+    };
+
+    BENCHMARK_ADVANCED("Scalar clamping")(Catch::Benchmark::Chronometer meter) {
+        auto copy = values;
+        meter.measure([&copy, &varying] {
+            for (auto &value : copy) {
+                value = std::clamp(value, varying.minValue, varying.maxValue);
+            }
+            return copy.front();
+        });
+    };
+
+    BENCHMARK_ADVANCED("Batch clamping")(Catch::Benchmark::Chronometer meter) {
+        auto copy = values;
+        meter.measure([&copy, &varying] {
+            varying.clamp(copy);
+            return copy.front();
+        });
+    };
+}
+
+TEST_CASE("Can intern Varyings", "[Varying]") {
+    VaryingStringPool pool;
+    REQUIRE(pool.intern(L"") == 0);
+    REQUIRE(pool.size() == 1);
+
+    const auto a = pool.intern(make_varying_string(L"quality >= 2", L"[a-z]+", L"low"));
+    const auto b = pool.intern(make_varying_string(L"quality >= 2", L"[a-z]+", L"low"));
+    const auto c = pool.intern(make_varying_string(L"quality >= 2", L".*"));
+    REQUIRE(a == b);
+    REQUIRE_FALSE(a == c);
+    REQUIRE(a.condition == c.condition);
+    REQUIRE(c.defaultValue == 0);
+    REQUIRE(std::hash<InternedVaryingString>{}(a) == std::hash<InternedVaryingString>{}(b));
+    REQUIRE(pool.size() == 5);
+
+    REQUIRE(pool.get(a.validPattern) == L"[a-z]+");
+    REQUIRE(pool.resolve(a) == make_varying_string(L"quality >= 2", L"[a-z]+", L"low"));
+
+    const Varying varying = make_varying_long(L"quality >= 2", 0, 10, 5);
+    const auto interned = pool.intern(varying);
+    REQUIRE(std::get<InternedVaryingLong>(interned).condition == a.condition);
+    REQUIRE(pool.resolve(interned) == std::get<VaryingLong>(varying));
+
+    const std::wstring large(20000, L'x');
+    REQUIRE(pool.get(pool.intern(large)) == large);
+    REQUIRE(pool.get(a.condition) == L"quality >= 2");
+}
+
+TEST_CASE("Can read Varying catalogs in place", "[Varying]") {
+    const std::vector<Varying> varyings = {
+            make_varying_string(L"platform == 'linux'", L"[a-z]+", L"low"),
+            make_varying_long(L"platform == 'linux'", -5, 5, 1),
+            make_varying_float(L"", 0.0, 1.0, 0.25),
+            make_varying_string(L""),
+    };
+
+    VaryingCatalogWriter writer;
+    for (const auto &varying : varyings) {
+        writer.add(varying);
+    }
+    REQUIRE(writer.size() == 4);
+
+    std::ostringstream os;
+    writer.write(os);
+    const auto bytes = os.str();
+
+    std::vector<uint64> buffer((bytes.size() + 7) / 8);
+    std::memcpy(buffer.data(), bytes.data(), bytes.size());
+    const std::span data(reinterpret_cast<const std::byte *>(buffer.data()), bytes.size());
+
+    const VaryingCatalog catalog(data);
+    REQUIRE(catalog.size() == 4);
+
+    const auto first = std::get<VaryingStringView>(catalog[0]);
+    REQUIRE(first.condition == L"platform == 'linux'");
+    REQUIRE(first.validPattern == L"[a-z]+");
+    REQUIRE(first.defaultValue == L"low");
+    REQUIRE(std::get<VaryingLongView>(catalog[1]).condition.data() == first.condition.data());
+    REQUIRE(std::get<VaryingLongView>(catalog[1]).minValue == -5);
+    REQUIRE(std::get<VaryingFloatView>(catalog[2]).defaultValue == 0.25);
+
+    const auto restored = catalog.toVaryings();
+    REQUIRE(restored.size() == varyings.size());
+    REQUIRE(restored[0] == std::get<VaryingString>(varyings[0]));
+    REQUIRE(restored[1] == std::get<VaryingLong>(varyings[1]));
+    REQUIRE(restored[2] == std::get<VaryingFloat>(varyings[2]));
+    REQUIRE(restored[3] == std::get<VaryingString>(varyings[3]));
+
+    const auto path = std::filesystem::temp_directory_path() / "eni_varying_catalog_test.bin";
+    writer.write(path);
+    {
+        auto mapped = VaryingCatalog::open(path);
+        REQUIRE(mapped.size() == 4);
+        REQUIRE(std::get<VaryingStringView>(mapped[0]).defaultValue == L"low");
+    }
+    std::filesystem::remove(path);
+
+    buffer[0] ^= 1;
+    REQUIRE_THROWS_AS(VaryingCatalog(data), ParseException);
+    REQUIRE_THROWS_AS(VaryingCatalog(data.first(16)), ParseException);
+    buffer[0] ^= 1;
+
+    // Offsets and lengths that would wrap around when added up.
+    auto crafted = buffer;
+    const std::span craftedData(reinterpret_cast<const std::byte *>(crafted.data()), bytes.size());
+    auto &header = *reinterpret_cast<varying_catalog::Header *>(crafted.data());
+    header.entriesOffset = ~uint64{0} - 7;
+    header.entryCount = 1;
+    REQUIRE_THROWS_AS(VaryingCatalog(craftedData), ParseException);
+    header = *reinterpret_cast<const varying_catalog::Header *>(buffer.data());
+    header.stringsLength = uint64{1} << 62;
+    REQUIRE_THROWS_AS(VaryingCatalog(craftedData), ParseException);
+}
+
+TEST_CASE("Varying equality is consistent with hashing", "[Varying]") {
+    REQUIRE(make_varying_long(L"x", 0, 10, 5) == make_varying_long(L"x", 0, 10, 5));
+    REQUIRE_FALSE(make_varying_long(L"x", 0, 10, 5) == make_varying_long(L"x", 0, 10, 6));
+    REQUIRE_FALSE(make_varying_long(L"x", 0, (int64{1} << 53) + 1) == make_varying_long(L"x", 0, int64{1} << 53));
+    REQUIRE_FALSE(make_varying_float(L"x", 0.0, 1.0) == make_varying_float(L"x", 0.0, 1.0 + 1e-12));
+
+    REQUIRE(std::hash<VaryingLong>{}(make_varying_long(L"x", 0, 10, 5)) == std::hash<VaryingLong>{}(make_varying_long(L"x", 0, 10, 5)));
+    REQUIRE(std::hash<VaryingFloat>{}(make_varying_float(L"x", -0.0, 1.0)) == std::hash<VaryingFloat>{}(make_varying_float(L"x", 0.0, 1.0)));
+    REQUIRE(std::hash<VaryingString>{}(make_varying_string(L"x", L".*", L"a")) != std::hash<VaryingString>{}(make_varying_string(L"x", L".*", L"b")));
+
+    std::unordered_set<Varying> set = {make_varying_string(L"x"), make_varying_string(L"x"), make_varying_long(L"x", 0, 1)};
+    REQUIRE(set.size() == 2);
+
+    // NaN bounds must not break reflexivity, or every registration would add a duplicate.
+    const auto nan = std::numeric_limits<double>::quiet_NaN();
+    const auto withNan = make_varying_float(L"x", 0.0, nan, -nan);
+    REQUIRE(withNan == withNan);
+    REQUIRE(std::hash<VaryingFloat>{}(withNan) == std::hash<VaryingFloat>{}(make_varying_float(L"x", 0.0, -nan, nan)));
+    REQUIRE_FALSE(withNan == make_varying_float(L"x", 0.0, 1.0, -nan));
+
+    VaryingRegistry registry;
+    REQUIRE(registry.add(withNan) == registry.add(withNan));
+    REQUIRE(registry.size() == 1);
+    const InternedVaryingFloat interned{0, nan, 0.0, nan};
+    REQUIRE(interned == interned);
+    REQUIRE(std::hash<InternedVaryingFloat>{}(interned) == std::hash<InternedVaryingFloat>{}(InternedVaryingFloat{0, -nan, 0.0, nan}));
+}
+
+TEST_CASE("Can deduplicate Varyings", "[Varying]") {
+    VaryingRegistry registry;
+
+    const auto a = registry.add(make_varying_string(L"quality > 1", L"[a-z]+", L"low"));
+    const auto b = registry.add(make_varying_long(L"quality > 1", 0, 3, 1));
+    REQUIRE(registry.add(make_varying_string(L"quality > 1", L"[a-z]+", L"low")) == a);
+    REQUIRE(registry.add(make_varying_long(L"quality > 1", 0, 3, 2)) != b);
+    REQUIRE(registry.size() == 3);
+
+    REQUIRE(registry.find(make_varying_long(L"quality > 1", 0, 3, 1)) == b);
+    REQUIRE(registry.find(Varying(make_varying_string(L"quality > 1", L"[a-z]+", L"low"))) == a);
+    REQUIRE_FALSE(registry.find(make_varying_float(L"quality > 1", 0, 3, 1)));
+    REQUIRE(registry.get(b) == make_varying_long(L"quality > 1", 0, 3, 1));
+}